@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <iostream>
+#include <rfl/bson.hpp>
+#include <rfl/cbor.hpp>
+#include <rfl/flexbuf.hpp>
+#include <rfl/json.hpp>
+#include <rfl/msgpack.hpp>
+#include <rfl/ubjson.hpp>
+#include <string>
+#include <vector>
+
+namespace nested_read {
+
+// ----------------------------------------------------------------------------
+// A deeply nested struct, which stresses formats that have to walk through
+// nested containers to skip them.
+
+struct Node {
+  std::string name;
+  std::vector<int64_t> values;
+  std::vector<Node> children;
+};
+
+// ----------------------------------------------------------------------------
+
+static Node load_data(const int64_t _depth) {
+  auto node = Node{.name = "leaf", .values = {1, 2, 3, 4, 5, 6, 7, 8}};
+  for (int64_t i = 1; i < _depth; ++i) {
+    node = Node{.name = "node_" + std::to_string(i),
+                .values = {1, 2, 3, 4, 5, 6, 7, 8},
+                .children = std::vector<Node>({std::move(node)})};
+  }
+  return node;
+}
+
+// ----------------------------------------------------------------------------
+
+static void BM_nested_read_reflect_cpp_bson(benchmark::State &state) {
+  const auto data = rfl::bson::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::bson::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_bson)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_nested_read_reflect_cpp_cbor(benchmark::State &state) {
+  const auto data = rfl::cbor::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::cbor::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_cbor)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_nested_read_reflect_cpp_flexbuf(benchmark::State &state) {
+  const auto data = rfl::flexbuf::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::flexbuf::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_flexbuf)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_nested_read_reflect_cpp_json(benchmark::State &state) {
+  const auto data = rfl::json::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::json::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_json)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_nested_read_reflect_cpp_msgpack(benchmark::State &state) {
+  const auto data = rfl::msgpack::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::msgpack::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_msgpack)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_nested_read_reflect_cpp_ubjson(benchmark::State &state) {
+  const auto data = rfl::ubjson::write(load_data(state.range(0)));
+  for (auto _ : state) {
+    const auto res = rfl::ubjson::read<Node>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_nested_read_reflect_cpp_ubjson)->Arg(4)->Arg(16)->Arg(64);
+
+// ----------------------------------------------------------------------------
+
+}  // namespace nested_read
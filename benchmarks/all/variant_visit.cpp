@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <rfl.hpp>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace variant_visit {
+
+// ----------------------------------------------------------------------------
+
+template <int _i>
+struct Alternative {
+  int value;
+};
+
+template <template <class...> class VariantType, class Seq>
+struct MakeVariant;
+
+template <template <class...> class VariantType, int... _is>
+struct MakeVariant<VariantType, std::integer_sequence<int, _is...>> {
+  using Type = VariantType<Alternative<_is>...>;
+};
+
+template <template <class...> class VariantType, int _n>
+using variant_t =
+    typename MakeVariant<VariantType, std::make_integer_sequence<int, _n>>::Type;
+
+// ----------------------------------------------------------------------------
+
+/// Generates variants holding each of the alternatives in turn, so that
+/// the branch predictor cannot simply guess the alternative.
+template <class VariantType, int _n>
+static std::vector<VariantType> load_data() {
+  auto data = std::vector<VariantType>();
+  const auto add = [&]<int... _is>(std::integer_sequence<int, _is...>) {
+    for (int k = 0; k < 1024; ++k) {
+      ((k % _n == _is ? (data.emplace_back(Alternative<_is>{k}), 0) : 0), ...);
+    }
+  };
+  add(std::make_integer_sequence<int, _n>());
+  return data;
+}
+
+template <int _n>
+static void BM_variant_visit_rfl_variant(benchmark::State &state) {
+  const auto data = load_data<variant_t<rfl::Variant, _n>, _n>();
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto &v : data) {
+      sum += v.visit([](const auto &_a) { return _a.value; });
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_variant_visit_rfl_variant<2>);
+BENCHMARK(BM_variant_visit_rfl_variant<8>);
+BENCHMARK(BM_variant_visit_rfl_variant<32>);
+BENCHMARK(BM_variant_visit_rfl_variant<64>);
+
+template <int _n>
+static void BM_variant_visit_std_variant(benchmark::State &state) {
+  const auto data = load_data<variant_t<std::variant, _n>, _n>();
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto &v : data) {
+      sum += std::visit([](const auto &_a) { return _a.value; }, v);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_variant_visit_std_variant<2>);
+BENCHMARK(BM_variant_visit_std_variant<8>);
+BENCHMARK(BM_variant_visit_std_variant<32>);
+BENCHMARK(BM_variant_visit_std_variant<64>);
+
+// ----------------------------------------------------------------------------
+
+}  // namespace variant_visit
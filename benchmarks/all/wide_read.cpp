@@ -0,0 +1,312 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <rfl/bson.hpp>
+#include <rfl/cbor.hpp>
+#include <rfl/flexbuf.hpp>
+#include <rfl/json.hpp>
+#include <rfl/msgpack.hpp>
+#include <rfl/ubjson.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace wide_read {
+
+// ----------------------------------------------------------------------------
+// A struct with many fields, which stresses the lookup of the field names.
+
+struct Wide {
+  double field_00;
+  int64_t field_01;
+  std::string field_02;
+  bool field_03;
+  double field_04;
+  int64_t field_05;
+  std::string field_06;
+  bool field_07;
+  double field_08;
+  int64_t field_09;
+  std::string field_10;
+  bool field_11;
+  double field_12;
+  int64_t field_13;
+  std::string field_14;
+  bool field_15;
+  double field_16;
+  int64_t field_17;
+  std::string field_18;
+  bool field_19;
+  double field_20;
+  int64_t field_21;
+  std::string field_22;
+  bool field_23;
+  double field_24;
+  int64_t field_25;
+  std::string field_26;
+  bool field_27;
+  double field_28;
+  int64_t field_29;
+  std::string field_30;
+  bool field_31;
+  double field_32;
+  int64_t field_33;
+  std::string field_34;
+  bool field_35;
+  double field_36;
+  int64_t field_37;
+  std::string field_38;
+  bool field_39;
+  double field_40;
+  int64_t field_41;
+  std::string field_42;
+  bool field_43;
+  double field_44;
+  int64_t field_45;
+  std::string field_46;
+  bool field_47;
+  double field_48;
+  int64_t field_49;
+  std::string field_50;
+  bool field_51;
+  double field_52;
+  int64_t field_53;
+  std::string field_54;
+  bool field_55;
+  double field_56;
+  int64_t field_57;
+  std::string field_58;
+  bool field_59;
+  double field_60;
+  int64_t field_61;
+  std::string field_62;
+  bool field_63;
+};
+
+struct WideCollection {
+  std::vector<Wide> items;
+};
+
+// ----------------------------------------------------------------------------
+
+static WideCollection load_data() {
+  Wide w{};
+  w.field_00 = 0.5;
+  w.field_01 = 1000;
+  w.field_02 = "value_02";
+  w.field_03 = true;
+  w.field_04 = 4.5;
+  w.field_05 = 5000;
+  w.field_06 = "value_06";
+  w.field_07 = false;
+  w.field_08 = 8.5;
+  w.field_09 = 9000;
+  w.field_10 = "value_10";
+  w.field_11 = true;
+  w.field_12 = 12.5;
+  w.field_13 = 13000;
+  w.field_14 = "value_14";
+  w.field_15 = false;
+  w.field_16 = 16.5;
+  w.field_17 = 17000;
+  w.field_18 = "value_18";
+  w.field_19 = true;
+  w.field_20 = 20.5;
+  w.field_21 = 21000;
+  w.field_22 = "value_22";
+  w.field_23 = false;
+  w.field_24 = 24.5;
+  w.field_25 = 25000;
+  w.field_26 = "value_26";
+  w.field_27 = true;
+  w.field_28 = 28.5;
+  w.field_29 = 29000;
+  w.field_30 = "value_30";
+  w.field_31 = false;
+  w.field_32 = 32.5;
+  w.field_33 = 33000;
+  w.field_34 = "value_34";
+  w.field_35 = true;
+  w.field_36 = 36.5;
+  w.field_37 = 37000;
+  w.field_38 = "value_38";
+  w.field_39 = false;
+  w.field_40 = 40.5;
+  w.field_41 = 41000;
+  w.field_42 = "value_42";
+  w.field_43 = true;
+  w.field_44 = 44.5;
+  w.field_45 = 45000;
+  w.field_46 = "value_46";
+  w.field_47 = false;
+  w.field_48 = 48.5;
+  w.field_49 = 49000;
+  w.field_50 = "value_50";
+  w.field_51 = true;
+  w.field_52 = 52.5;
+  w.field_53 = 53000;
+  w.field_54 = "value_54";
+  w.field_55 = false;
+  w.field_56 = 56.5;
+  w.field_57 = 57000;
+  w.field_58 = "value_58";
+  w.field_59 = true;
+  w.field_60 = 60.5;
+  w.field_61 = 61000;
+  w.field_62 = "value_62";
+  w.field_63 = false;
+  return WideCollection{.items = std::vector<Wide>(100, w)};
+}
+
+// ----------------------------------------------------------------------------
+
+static void BM_wide_read_reflect_cpp_bson(benchmark::State &state) {
+  const auto data = rfl::bson::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::bson::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_bson);
+
+static void BM_wide_read_reflect_cpp_bson_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::bson::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::bson::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_bson_assume_ordered_fields);
+
+static void BM_wide_read_reflect_cpp_cbor(benchmark::State &state) {
+  const auto data = rfl::cbor::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::cbor::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_cbor);
+
+static void BM_wide_read_reflect_cpp_cbor_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::cbor::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::cbor::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_cbor_assume_ordered_fields);
+
+static void BM_wide_read_reflect_cpp_flexbuf(benchmark::State &state) {
+  const auto data = rfl::flexbuf::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::flexbuf::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_flexbuf);
+
+static void BM_wide_read_reflect_cpp_flexbuf_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::flexbuf::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::flexbuf::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_flexbuf_assume_ordered_fields);
+
+static void BM_wide_read_reflect_cpp_json(benchmark::State &state) {
+  const auto data = rfl::json::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::json::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_json);
+
+static void BM_wide_read_reflect_cpp_json_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::json::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::json::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_json_assume_ordered_fields);
+
+static void BM_wide_read_reflect_cpp_msgpack(benchmark::State &state) {
+  const auto data = rfl::msgpack::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::msgpack::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_msgpack);
+
+static void BM_wide_read_reflect_cpp_msgpack_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::msgpack::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::msgpack::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_msgpack_assume_ordered_fields);
+
+static void BM_wide_read_reflect_cpp_ubjson(benchmark::State &state) {
+  const auto data = rfl::ubjson::write(load_data());
+  for (auto _ : state) {
+    const auto res = rfl::ubjson::read<WideCollection>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_ubjson);
+
+static void BM_wide_read_reflect_cpp_ubjson_assume_ordered_fields(
+    benchmark::State &state) {
+  const auto data = rfl::ubjson::write(load_data());
+  for (auto _ : state) {
+    const auto res =
+        rfl::ubjson::read<WideCollection, rfl::AssumeOrderedFields>(data);
+    if (!res) {
+      std::cout << res.error()->what() << std::endl;
+    }
+  }
+}
+BENCHMARK(BM_wide_read_reflect_cpp_ubjson_assume_ordered_fields);
+
+// ----------------------------------------------------------------------------
+
+}  // namespace wide_read
@@ -423,6 +423,42 @@ static void BM_canada_reflect_cpp(benchmark::State &state) {
 }
 BENCHMARK(BM_canada_reflect_cpp);
 
+static void BM_canada_write_reflect_cpp(benchmark::State &state) {
+  const auto obj = rfl::json::read<FeatureCollection>(load_data()).value();
+  for (auto _ : state) {
+    const auto json_str = rfl::json::write(obj);
+    benchmark::DoNotOptimize(json_str);
+  }
+}
+BENCHMARK(BM_canada_write_reflect_cpp);
+
+static void BM_canada_write_reflect_cpp_direct(benchmark::State &state) {
+  const auto obj = rfl::json::read<FeatureCollection>(load_data()).value();
+  for (auto _ : state) {
+    const auto json_str = rfl::json::write_direct(obj);
+    benchmark::DoNotOptimize(json_str);
+  }
+}
+BENCHMARK(BM_canada_write_reflect_cpp_direct);
+
+static void BM_canada_write_reflect_cpp_direct_pretty(benchmark::State &state) {
+  const auto obj = rfl::json::read<FeatureCollection>(load_data()).value();
+  for (auto _ : state) {
+    const auto json_str = rfl::json::write_direct(obj, rfl::json::pretty);
+    benchmark::DoNotOptimize(json_str);
+  }
+}
+BENCHMARK(BM_canada_write_reflect_cpp_direct_pretty);
+
+static void BM_canada_write_reflect_cpp_pretty(benchmark::State &state) {
+  const auto obj = rfl::json::read<FeatureCollection>(load_data()).value();
+  for (auto _ : state) {
+    const auto json_str = rfl::json::write(obj, rfl::json::pretty);
+    benchmark::DoNotOptimize(json_str);
+  }
+}
+BENCHMARK(BM_canada_write_reflect_cpp_pretty);
+
 // ----------------------------------------------------------------------------
 
 }  // namespace canada
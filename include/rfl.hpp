@@ -12,13 +12,17 @@
 #include "rfl/AllOf.hpp"
 #include "rfl/AllowRawPtrs.hpp"
 #include "rfl/AnyOf.hpp"
+#include "rfl/AssumeOrderedFields.hpp"
 #include "rfl/Attribute.hpp"
 #include "rfl/Binary.hpp"
+#include "rfl/Borrowed.hpp"
 #include "rfl/Box.hpp"
 #include "rfl/Bytestring.hpp"
+#include "rfl/CompactGeneric.hpp"
 #include "rfl/DefaultIfMissing.hpp"
 #include "rfl/Description.hpp"
 #include "rfl/ExtraFields.hpp"
+#include "rfl/FailFast.hpp"
 #include "rfl/Field.hpp"
 #include "rfl/Flatten.hpp"
 #include "rfl/Generic.hpp"
@@ -41,6 +45,7 @@
 #include "rfl/SnakeCaseToCamelCase.hpp"
 #include "rfl/SnakeCaseToPascalCase.hpp"
 #include "rfl/TaggedUnion.hpp"
+#include "rfl/ThreadPool.hpp"
 #include "rfl/Timestamp.hpp"
 #include "rfl/UnderlyingEnums.hpp"
 #include "rfl/Validator.hpp"
@@ -69,6 +74,7 @@
 #include "rfl/patterns.hpp"
 #include "rfl/remove_fields.hpp"
 #include "rfl/replace.hpp"
+#include "rfl/to_compact_generic.hpp"
 #include "rfl/to_generic.hpp"
 #include "rfl/to_named_tuple.hpp"
 #include "rfl/to_view.hpp"
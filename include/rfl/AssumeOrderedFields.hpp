@@ -0,0 +1,22 @@
+#ifndef RFL_ASSUMEORDEREDFIELDS_HPP_
+#define RFL_ASSUMEORDEREDFIELDS_HPP_
+
+namespace rfl {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the parsers to expect the fields in the order in which
+/// they are declared. Every key is first compared to the field following the
+/// one that was matched last and only looked up in the full set of field
+/// names if that comparison fails, so documents in any order can still be
+/// read.
+struct AssumeOrderedFields {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace rfl
+
+#endif
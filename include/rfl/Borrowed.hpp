@@ -0,0 +1,70 @@
+#ifndef RFL_BORROWED_HPP_
+#define RFL_BORROWED_HPP_
+
+#include <memory>
+#include <utility>
+
+namespace rfl {
+
+/// An object that has been read using one of the read_borrowed(...)
+/// functions. Fields of type std::string_view or rfl::BytestringView point
+/// directly into the parsed document, so the document is kept alive for as
+/// long as the object itself.
+template <class T>
+class Borrowed {
+ public:
+  /// An owning handle on the underlying document. Formats that parse
+  /// directly from the input buffer do not need a document, in which case the
+  /// handle is empty and the input buffer must outlive the object.
+  using DocumentType = std::unique_ptr<void, void (*)(void*)>;
+
+  Borrowed(DocumentType&& _doc, T&& _value)
+      : doc_(std::move(_doc)), value_(std::move(_value)) {}
+
+  Borrowed(Borrowed<T>&& _other) noexcept = default;
+
+  Borrowed(const Borrowed<T>& _other) = delete;
+
+  ~Borrowed() = default;
+
+  /// Returns the underlying object.
+  T& value() noexcept { return value_; }
+
+  /// Returns the underlying object.
+  const T& value() const noexcept { return value_; }
+
+  /// Returns the underlying object.
+  T& operator*() noexcept { return value_; }
+
+  /// Returns the underlying object.
+  const T& operator*() const noexcept { return value_; }
+
+  /// Returns the underlying object.
+  T* operator->() noexcept { return &value_; }
+
+  /// Returns the underlying object.
+  const T* operator->() const noexcept { return &value_; }
+
+  /// Move assignment operator.
+  Borrowed<T>& operator=(Borrowed<T>&& _other) noexcept = default;
+
+  /// Copy assignment operator.
+  Borrowed<T>& operator=(const Borrowed<T>& _other) = delete;
+
+  /// Generates a document handle for formats that do not need one.
+  static DocumentType no_document() noexcept {
+    return DocumentType(nullptr, [](void*) {});
+  }
+
+ private:
+  /// The document the object points into. It must be declared before the
+  /// value, so that it is destroyed after it.
+  DocumentType doc_;
+
+  /// The underlying object.
+  T value_;
+};
+
+}  // namespace rfl
+
+#endif
@@ -2,12 +2,17 @@
 #define RFL_BYTESTRING_HPP_
 
 #include <cstddef>
+#include <span>
 #include <string>
 
 namespace rfl {
 
 using Bytestring = std::basic_string<std::byte>;
 
+/// A non-owning view on a bytestring, which can only be read using the
+/// read_borrowed(...) functions.
+using BytestringView = std::span<const std::byte>;
+
 }  // namespace rfl
 
 #endif
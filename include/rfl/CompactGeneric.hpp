@@ -0,0 +1,236 @@
+#ifndef RFL_COMPACTGENERIC_HPP_
+#define RFL_COMPACTGENERIC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "Generic.hpp"
+#include "Result.hpp"
+
+namespace rfl {
+
+/// A read-only alternative to rfl::Generic that needs far less memory. All
+/// nodes of a document are stored in a single arena, every node takes 16
+/// bytes and every field of an object takes 32 bytes. Keys are interned, so
+/// a key that occurs many times, such as the field names of an array of
+/// objects, is only stored once. Strings of up to 13 characters are stored
+/// inside of the node itself. Unlike rfl::Generic, integers have 64 bits.
+///
+/// Copies share the same arena, which makes copying very cheap. If you need
+/// to modify the data, use to_generic().
+class CompactGeneric {
+ public:
+  enum class Type : uint8_t {
+    null,
+    boolean,
+    integer,
+    floating_point,
+    string,
+    array,
+    object
+  };
+
+  class Arena;
+  class Builder;
+  struct Member;
+
+  /// A single node of the document. Because short strings are stored inside
+  /// the node, string views returned by to_string_view() may point into the
+  /// node and must not outlive it.
+  class Value {
+    friend class Builder;
+
+   public:
+    /// The maximum length of a string that is stored inside of the node.
+    static constexpr size_t max_small_size_ = 13;
+
+    Value() noexcept : small_{Type::null, false, 0, {}} {}
+
+    /// The type of the underlying value.
+    Type type() const noexcept { return small_.type_; }
+
+    /// Whether the node contains the null value.
+    bool is_null() const noexcept { return type() == Type::null; }
+
+    /// The number of elements of an array, the number of fields of an object
+    /// or the length of a string. 0 for all other types.
+    size_t size() const noexcept;
+
+    /// Returns the value of the field named _key or nullptr, if this is not
+    /// an object or there is no such field.
+    const Value* find(const std::string_view _key) const noexcept;
+
+    /// Returns the elements or an rfl::Error, if the underlying value is not
+    /// an array.
+    Result<std::span<const Value>> to_array() const noexcept;
+
+    /// Returns the underlying value or an rfl::Error, if the underlying value
+    /// is not a boolean.
+    Result<bool> to_bool() const noexcept;
+
+    /// Returns the underlying value or an rfl::Error, if the underlying value
+    /// is neither a floating point number nor an integer.
+    Result<double> to_double() const noexcept;
+
+    /// Returns the underlying value or an rfl::Error, if the underlying value
+    /// is not an integer.
+    Result<int64_t> to_int() const noexcept;
+
+    /// Returns the fields or an rfl::Error, if the underlying value is not an
+    /// object.
+    Result<std::span<const Member>> to_object() const noexcept;
+
+    /// Returns the underlying value or an rfl::Error, if the underlying value
+    /// is not a string.
+    Result<std::string> to_string() const noexcept;
+
+    /// Returns a view of the underlying value or an rfl::Error, if the
+    /// underlying value is not a string.
+    Result<std::string_view> to_string_view() const noexcept;
+
+   private:
+    struct Small {
+      Type type_;
+      bool is_small_;
+      uint8_t size_;
+      char chars_[max_small_size_];
+    };
+
+    struct Large {
+      Type type_;
+      bool is_small_;
+      uint32_t size_;
+      union {
+        bool bool_;
+        int64_t int_;
+        double double_;
+        const char* chars_;
+        const Value* values_;
+        const Member* members_;
+      };
+    };
+
+    /// Both structs start with the same members, so type_ and is_small_ can
+    /// always be read through small_.
+    union {
+      Small small_;
+      Large large_;
+    };
+  };
+
+  /// A field of an object.
+  struct Member {
+    std::string_view key_;
+    Value value_;
+  };
+
+  /// Assembles a document node by node in the order in which a parser or a
+  /// writer visits them. Inside of an object, every node must be given its
+  /// key, everywhere else the key is ignored. Every begin_array(...) and
+  /// begin_object(...) must be followed by a matching end(...) once all of
+  /// its elements have been added.
+  class Builder {
+   public:
+    Builder();
+
+    Builder(const Builder& _other) = delete;
+
+    Builder(Builder&& _other) noexcept;
+
+    ~Builder();
+
+    void add_bool(const std::string_view _key, const bool _val);
+
+    void add_double(const std::string_view _key, const double _val);
+
+    void add_int(const std::string_view _key, const int64_t _val);
+
+    void add_null(const std::string_view _key);
+
+    void add_string(const std::string_view _key, const std::string_view _val);
+
+    /// Returns a handle that must be passed to end(...).
+    size_t begin_array(const std::string_view _key);
+
+    /// Returns a handle that must be passed to end(...).
+    size_t begin_object(const std::string_view _key);
+
+    /// Completes the array or object identified by _handle.
+    void end(const size_t _handle);
+
+    /// Returns the document. The builder must not be used afterwards.
+    CompactGeneric build();
+
+    Builder& operator=(const Builder& _other) = delete;
+
+    Builder& operator=(Builder&& _other) noexcept;
+
+   private:
+    std::string_view intern(const std::string_view _key);
+
+    static Value make_value(const Type _type) noexcept;
+
+    void push(const std::string_view _key, const Value& _val);
+
+   private:
+    /// The memory for the nodes, keys and strings.
+    std::shared_ptr<Arena> arena_;
+
+    /// The interned keys, all of which point into the arena.
+    std::unordered_set<std::string_view> keys_;
+
+    /// The nodes of all arrays and objects that have been begun, but not yet
+    /// ended. They are copied into the arena by end(...).
+    std::vector<Member> stack_;
+  };
+
+  /// Creates a document containing the null value.
+  CompactGeneric() noexcept;
+
+  /// Converts an rfl::Generic.
+  explicit CompactGeneric(const Generic& _g);
+
+  CompactGeneric(const CompactGeneric& _other) noexcept;
+
+  CompactGeneric(CompactGeneric&& _other) noexcept;
+
+  ~CompactGeneric();
+
+  /// Returns the root node.
+  const Value& get() const noexcept { return root_; }
+
+  /// Whether the document contains the null value.
+  bool is_null() const noexcept { return root_.is_null(); }
+
+  /// The number of bytes held by the arena.
+  size_t memory_usage() const noexcept;
+
+  /// Converts the document to an rfl::Generic. rfl::Generic only supports
+  /// 32-bit integers, so integers that do not fit are converted to doubles.
+  Generic to_generic() const;
+
+  CompactGeneric& operator=(const CompactGeneric& _other) noexcept;
+
+  CompactGeneric& operator=(CompactGeneric&& _other) noexcept;
+
+ private:
+  CompactGeneric(std::shared_ptr<const Arena>&& _arena, const Value& _root);
+
+ private:
+  /// The memory the nodes point to. Can be nullptr, if there are no such
+  /// nodes.
+  std::shared_ptr<const Arena> arena_;
+
+  /// The root node.
+  Value root_;
+};
+
+}  // namespace rfl
+
+#endif
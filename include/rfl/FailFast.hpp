@@ -0,0 +1,21 @@
+#ifndef RFL_FAILFAST_HPP_
+#define RFL_FAILFAST_HPP_
+
+namespace rfl {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the parsers to stop at the first error instead of
+/// collecting all of them. The names of the fields that lead to the error
+/// are recorded separately, and the error message is only put together when
+/// what() is first called.
+struct FailFast {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace rfl
+
+#endif
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -224,6 +225,14 @@ class Literal {
   /// Alias for .name().
   std::string str() const { return name(); }
 
+  /// Returns the string associated with _value at compile time.
+  template <int _value>
+  static constexpr std::string_view string_view_of() {
+    static_assert(_value >= 0 && _value < num_fields_,
+                  "Value cannot exceed number of fields.");
+    return tuple_element_t<_value, FieldsType>::name_.string_view();
+  }
+
   /// Alias for .names().
   static std::vector<std::string> strings() {
     return allowed_strings_vec(std::make_integer_sequence<int, num_fields_>());
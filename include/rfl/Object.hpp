@@ -2,6 +2,8 @@
 #define RFL_OBJECT_HPP_
 
 #include <algorithm>
+#include <atomic>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -9,11 +11,23 @@
 #include <vector>
 
 #include "Result.hpp"
+#include "internal/ObjectIndex.hpp"
 
 namespace rfl {
 
 /// Used to embed additional fields for which the names cannot be known in
 /// advance and can therefore not be encoded in the struct.
+///
+/// The fields are kept in insertion order. Once an object has more than
+/// index_threshold_ fields, the first lookup builds a hash index, so that
+/// looking up fields in large objects does not require a linear scan. The
+/// index is published atomically, so several threads can look up fields in
+/// the same object at the same time, as long as none of them modifies it.
+///
+/// The keys can be modified through non-const iterators, which the index
+/// would not notice. Handing out such an iterator therefore only marks the
+/// keys as exposed, which makes lookups fall back to a linear scan, until
+/// an operation that invalidates all iterators makes the index safe again.
 template <class T>
 class Object {
  public:
@@ -36,16 +50,29 @@ class Object {
   using reverse_iterator = typename DataType::reverse_iterator;
   using const_reverse_iterator = typename DataType::const_reverse_iterator;
 
-  Object() : data_(), i_(0) {}
+  /// Objects with more fields than this are looked up using a hash index.
+  static constexpr size_t index_threshold_ = 16;
 
-  Object(const Object<T>& _f) = default;
+  Object() : data_(), index_(nullptr), keys_exposed_(false) {}
 
-  Object(Object<T>&& _f) noexcept = default;
+  Object(const Object<T>& _f)
+      : data_(_f.data_), index_(nullptr), keys_exposed_(false) {}
 
-  ~Object() = default;
+  /// Iterators into _f remain valid and now point into this object, so
+  /// whether the keys are exposed is moved along with the data.
+  Object(Object<T>&& _f) noexcept
+      : data_(std::move(_f.data_)),
+        index_(_f.index_.exchange(nullptr)),
+        keys_exposed_(_f.keys_exposed_.exchange(false)) {}
 
-  /// Iterator to the beginning.
-  auto begin() { return data_.begin(); }
+  ~Object() { delete index_.load(); }
+
+  /// Iterator to the beginning. The keys might be modified through the
+  /// iterator, so this marks them as exposed.
+  auto begin() {
+    expose_keys();
+    return data_.begin();
+  }
 
   /// Iterator to the beginning.
   auto begin() const { return data_.begin(); }
@@ -53,8 +80,12 @@ class Object {
   /// Const iterator to the beginning.
   auto cbegin() const { return data_.cbegin(); }
 
-  /// Iterator to the end.
-  auto end() { return data_.end(); }
+  /// Iterator to the end. The keys might be modified through the iterator,
+  /// so this marks them as exposed.
+  auto end() {
+    expose_keys();
+    return data_.end();
+  }
 
   /// Iterator to the end.
   auto end() const { return data_.end(); }
@@ -62,8 +93,12 @@ class Object {
   /// Const iterator to the end.
   auto cend() const { return data_.cend(); }
 
-  /// Reverse iterator.
-  auto rbegin() { return data_.rbegin(); }
+  /// Reverse iterator. The keys might be modified through the iterator, so
+  /// this marks them as exposed.
+  auto rbegin() {
+    expose_keys();
+    return data_.rbegin();
+  }
 
   /// Reverse iterator.
   auto rbegin() const { return data_.rbegin(); }
@@ -71,8 +106,12 @@ class Object {
   /// Const reverse iterator.
   auto crbegin() const { return data_.crbegin(); }
 
-  /// Reverse iterator.
-  auto rend() { return data_.rend(); }
+  /// Reverse iterator. The keys might be modified through the iterator, so
+  /// this marks them as exposed.
+  auto rend() {
+    expose_keys();
+    return data_.rend();
+  }
 
   /// Reverse iterator.
   auto rend() const { return data_.rend(); }
@@ -80,9 +119,22 @@ class Object {
   /// Const reverse iterator.
   auto crend() const { return data_.crend(); }
 
-  Object<T>& operator=(const Object<T>& _f) = default;
+  Object<T>& operator=(const Object<T>& _f) {
+    if (this != &_f) {
+      data_ = _f.data_;
+      reset_index();
+    }
+    return *this;
+  }
 
-  Object<T>& operator=(Object<T>&& _f) = default;
+  Object<T>& operator=(Object<T>&& _f) noexcept {
+    if (this != &_f) {
+      data_ = std::move(_f.data_);
+      delete index_.exchange(_f.index_.exchange(nullptr));
+      keys_exposed_.store(_f.keys_exposed_.exchange(false));
+    }
+    return *this;
+  }
 
   /// Whether the object is empty.
   auto empty() const { return data_.size() == 0; }
@@ -95,14 +147,16 @@ class Object {
 
   /// Inserts a new element at the end.
   void insert(const value_type& _value) {
+    const auto capacity = data_.capacity();
     data_.push_back(_value);
-    i_ = 0;
+    add_last_to_index(capacity);
   }
 
   /// Inserts a new element at the end.
   void insert(value_type&& _value) {
+    const auto capacity = data_.capacity();
     data_.emplace_back(std::move(_value));
-    i_ = 0;
+    add_last_to_index(capacity);
   }
 
   /// Inserts several new elements at the end.
@@ -158,8 +212,9 @@ class Object {
     if (i != size()) {
       return data_[i].second;
     }
+    const auto capacity = data_.capacity();
     data_.emplace_back(std::make_pair(_key, T()));
-    i_ = 0;
+    add_last_to_index(capacity);
     return data_.back().second;
   }
 
@@ -169,15 +224,17 @@ class Object {
     if (i != size()) {
       return data_[i].second;
     }
+    const auto capacity = data_.capacity();
     data_.emplace_back(std::make_pair(std::move(_key), T()));
-    i_ = 0;
+    add_last_to_index(capacity);
     return data_.back().second;
   }
 
   /// Deletes all elements.
   void clear() {
     data_.clear();
-    i_ = 0;
+    reset_index();
+    keys_exposed_.store(false);
   }
 
   /// Returns the element signified by the key or throws an exception.
@@ -208,27 +265,90 @@ class Object {
   }
 
  private:
-  size_t find(const std::string& _key) const {
-    for (auto i = i_; i < size(); ++i) {
-      if (data_[i].first == _key) {
-        i_ = i + 1;
-        return i;
+  /// Keeps the index up-to-date after a field has been added at the end.
+  /// Requires exclusive access, like all non-const methods. If the index
+  /// cannot grow, it is discarded and rebuilt by the next lookup. If adding
+  /// the field has reallocated the data, all iterators are invalidated, so
+  /// the keys are no longer exposed, but the index might have gone stale.
+  void add_last_to_index(const size_t _capacity_before) noexcept {
+    if (data_.capacity() != _capacity_before &&
+        keys_exposed_.load(std::memory_order_relaxed)) {
+      reset_index();
+      keys_exposed_.store(false, std::memory_order_relaxed);
+      return;
+    }
+    const auto index = index_.load(std::memory_order_relaxed);
+    if (index) {
+      try {
+        index->add_last(data_);
+      } catch (const std::bad_alloc&) {
+        reset_index();
       }
     }
-    for (auto i = 0; i < i_; ++i) {
+  }
+
+  /// Returns the position of the first field named _key or size(), if
+  /// there is no such field.
+  size_t find(const std::string& _key) const noexcept {
+    if (size() > index_threshold_ &&
+        !keys_exposed_.load(std::memory_order_relaxed)) {
+      if (const auto index = get_index()) {
+        return index->find(_key, data_);
+      }
+    }
+    for (size_t i = 0; i < size(); ++i) {
       if (data_[i].first == _key) {
-        i_ = i + 1;
         return i;
       }
     }
     return size();
   }
 
+  /// Returns the index, building it if necessary, or nullptr, if there is
+  /// not enough memory to build it. Several threads might build the index
+  /// at the same time, but only one of them gets to publish it.
+  const internal::ObjectIndex* get_index() const noexcept {
+    auto index = index_.load(std::memory_order_acquire);
+    if (index) {
+      return index;
+    }
+    internal::ObjectIndex* new_index = nullptr;
+    try {
+      new_index = new internal::ObjectIndex(data_);
+    } catch (const std::bad_alloc&) {
+      return nullptr;
+    }
+    if (index_.compare_exchange_strong(index, new_index,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+      return new_index;
+    }
+    delete new_index;
+    return index;
+  }
+
+  /// Marks the keys as exposed. Unlike discarding the index, this is safe
+  /// while other threads are looking up fields.
+  void expose_keys() noexcept {
+    keys_exposed_.store(true, std::memory_order_relaxed);
+  }
+
+  /// Requires exclusive access, because other threads might be using the
+  /// index.
+  void reset_index() noexcept { delete index_.exchange(nullptr); }
+
  private:
   DataType data_;
 
-  /// Allows faster access
-  mutable size_t i_;
+  /// The hash index, which is only built once it is needed. Not copied
+  /// along with the data.
+  mutable std::atomic<internal::ObjectIndex*> index_;
+
+  /// Whether non-const iterators have been handed out since the last
+  /// operation that invalidated all iterators. While this is set, the keys
+  /// might have been renamed behind the back of the index, so the index is
+  /// neither used nor built.
+  std::atomic<bool> keys_exposed_;
 };
 
 }  // namespace rfl
@@ -5,7 +5,10 @@
 
 #include "internal/is_add_tags_to_variants_v.hpp"
 #include "internal/is_allow_raw_ptrs_v.hpp"
+#include "internal/is_assume_ordered_fields_v.hpp"
+#include "internal/is_borrow_from_document_v.hpp"
 #include "internal/is_default_if_missing_v.hpp"
+#include "internal/is_fail_fast_v.hpp"
 #include "internal/is_no_extra_fields_v.hpp"
 #include "internal/is_no_field_names_v.hpp"
 #include "internal/is_no_optionals_v.hpp"
@@ -21,7 +24,10 @@ struct Processors<> {
   static constexpr bool add_tags_to_variants_ = false;
   static constexpr bool allow_raw_ptrs_ = false;
   static constexpr bool all_required_ = false;
+  static constexpr bool assume_ordered_fields_ = false;
+  static constexpr bool borrow_from_document_ = false;
   static constexpr bool default_if_missing_ = false;
+  static constexpr bool fail_fast_ = false;
   static constexpr bool no_extra_fields_ = false;
   static constexpr bool no_field_names_ = false;
   static constexpr bool underlying_enums_ = false;
@@ -46,10 +52,22 @@ struct Processors<Head, Tail...> {
       std::disjunction_v<internal::is_no_optionals<Head>,
                          internal::is_no_optionals<Tail>...>;
 
+  static constexpr bool assume_ordered_fields_ =
+      std::disjunction_v<internal::is_assume_ordered_fields<Head>,
+                         internal::is_assume_ordered_fields<Tail>...>;
+
+  static constexpr bool borrow_from_document_ =
+      std::disjunction_v<internal::is_borrow_from_document<Head>,
+                         internal::is_borrow_from_document<Tail>...>;
+
   static constexpr bool default_if_missing_ =
       std::disjunction_v<internal::is_default_if_missing<Head>,
                          internal::is_default_if_missing<Tail>...>;
 
+  static constexpr bool fail_fast_ =
+      std::disjunction_v<internal::is_fail_fast<Head>,
+                         internal::is_fail_fast<Tail>...>;
+
   static constexpr bool no_extra_fields_ =
       std::disjunction_v<internal::is_no_extra_fields<Head>,
                          internal::is_no_extra_fields<Tail>...>;
@@ -3,11 +3,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "internal/is_array.hpp"
 #include "internal/to_std_array.hpp"
@@ -19,14 +24,97 @@ class Error {
  public:
   Error(const std::string& _what) : what_(_what) {}
 
+  Error(const Error& _other)
+      : what_(_other.what_),
+        path_(_other.path_ ? std::make_unique<Path>(_other.path_->names_)
+                           : nullptr) {}
+
+  Error(Error&& _other) noexcept = default;
+
   ~Error() = default;
 
   /// Returns the error message, equivalent to .what() in std::exception.
-  const std::string& what() const { return what_; }
+  const std::string& what() const {
+    if (!path_) {
+      return what_;
+    }
+    return path_->format(what_);
+  }
+
+  /// Records that the error occurred while parsing the field _name. This is
+  /// equivalent to prepending "Failed to parse field '_name': " to the
+  /// message, but the message is only put together when what() is first
+  /// called. This is used by rfl::FailFast.
+  void add_field_to_path(const std::string_view _name) {
+    if (!path_) {
+      path_ = std::make_unique<Path>();
+    } else {
+      path_->reset();
+    }
+    path_->names_.emplace_back(_name);
+  }
+
+  Error& operator=(const Error& _other) {
+    if (this != &_other) {
+      *this = Error(_other);
+    }
+    return *this;
+  }
+
+  Error& operator=(Error&& _other) noexcept = default;
+
+ private:
+  /// The names of the fields in which the error occurred, innermost first,
+  /// and the message including them, once it has been put together.
+  struct Path {
+    Path() = default;
+
+    explicit Path(const std::vector<std::string>& _names) : names_(_names) {}
+
+    ~Path() { reset(); }
+
+    /// Puts the message together on the first call. Several threads might
+    /// do so at the same time, but only one of them gets to publish it.
+    const std::string& format(const std::string& _what) const {
+      auto formatted = formatted_.load(std::memory_order_acquire);
+      if (formatted) {
+        return *formatted;
+      }
+      constexpr auto prefix = std::string_view("Failed to parse field '");
+      constexpr auto suffix = std::string_view("': ");
+      auto size = _what.size();
+      for (const auto& name : names_) {
+        size += prefix.size() + name.size() + suffix.size();
+      }
+      auto new_formatted = std::make_unique<std::string>();
+      new_formatted->reserve(size);
+      for (auto it = names_.rbegin(); it != names_.rend(); ++it) {
+        new_formatted->append(prefix).append(*it).append(suffix);
+      }
+      new_formatted->append(_what);
+      if (formatted_.compare_exchange_strong(formatted, new_formatted.get(),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+        return *new_formatted.release();
+      }
+      return *formatted;
+    }
+
+    /// Requires exclusive access, because other threads might be reading
+    /// the formatted message.
+    void reset() noexcept { delete formatted_.exchange(nullptr); }
+
+    std::vector<std::string> names_;
+
+    mutable std::atomic<std::string*> formatted_{nullptr};
+  };
 
  private:
   /// Documents what went wrong
   std::string what_;
+
+  /// Only set, if fields have been added through add_field_to_path.
+  std::unique_ptr<Path> path_;
 };
 
 /// Can be used when we are simply interested in whether an operation was
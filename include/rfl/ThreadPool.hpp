@@ -0,0 +1,114 @@
+#ifndef RFL_THREADPOOL_HPP_
+#define RFL_THREADPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rfl {
+
+/// A fixed set of worker threads used to process batches of independent
+/// tasks, such as read_many(...). The threads are started once and then
+/// reused for every batch.
+///
+/// The thread calling for_each(...) takes part in the work, so a pool with
+/// N workers starts N - 1 threads. Every task is identified by the index of
+/// the worker executing it, which makes it easy to keep per-worker state,
+/// like parser contexts, without any locking.
+class ThreadPool {
+ public:
+  /// Creates a pool with _num_workers workers (including the calling
+  /// thread). Uses all available cores by default.
+  explicit ThreadPool(const size_t _num_workers = default_num_workers());
+
+  ThreadPool(const ThreadPool& _other) = delete;
+
+  ThreadPool(ThreadPool&& _other) = delete;
+
+  ~ThreadPool();
+
+  /// The number of available hardware threads, but at least 1.
+  static size_t default_num_workers() noexcept;
+
+  /// Calls _f(_worker, _i) for every _i in [0, _n) and returns once all of
+  /// them are done. _worker is in [0, num_workers()) and no two tasks with
+  /// the same _worker are executed concurrently. _f must not throw.
+  ///
+  /// The indices are handed out in chunks: whenever a worker is done with
+  /// its chunk, it claims the next one, so fast workers automatically take
+  /// over work that slower workers have not gotten to yet.
+  template <class F>
+  void for_each(const size_t _n, const F& _f) {
+    const auto call = [](const void* _ctx, const size_t _worker,
+                         const size_t _i) {
+      (*static_cast<const F*>(_ctx))(_worker, _i);
+    };
+    run(_n, call, &_f);
+  }
+
+  /// The number of workers, including the calling thread.
+  size_t num_workers() const noexcept { return threads_.size() + 1; }
+
+  ThreadPool& operator=(const ThreadPool& _other) = delete;
+
+  ThreadPool& operator=(ThreadPool&& _other) = delete;
+
+ private:
+  using TaskType = void (*)(const void*, const size_t, const size_t);
+
+  /// Claims chunks of the current batch, until there are none left.
+  void process(const size_t _worker);
+
+  /// Runs a type-erased batch.
+  void run(const size_t _n, TaskType _task, const void* _ctx);
+
+  /// The loop executed by the threads.
+  void work(const size_t _worker);
+
+ private:
+  /// The size of the chunks the current batch is split into.
+  size_t chunk_size_;
+
+  /// The context passed to the task.
+  const void* ctx_;
+
+  /// Signals the threads that there is a new batch or that they should stop.
+  std::condition_variable cv_start_;
+
+  /// Signals the calling thread that all threads are done.
+  std::condition_variable cv_done_;
+
+  /// Incremented for every batch.
+  size_t generation_;
+
+  /// Protects the state shared with the threads.
+  std::mutex mtx_;
+
+  /// The number of tasks in the current batch.
+  size_t n_;
+
+  /// The next index to be claimed.
+  std::atomic<size_t> next_;
+
+  /// The number of threads still working on the current batch.
+  size_t num_active_;
+
+  /// Makes sure only one batch is run at a time.
+  std::mutex run_mtx_;
+
+  /// Whether the threads should stop.
+  bool stop_;
+
+  /// The task to be executed.
+  TaskType task_;
+
+  /// The worker threads.
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace rfl
+
+#endif
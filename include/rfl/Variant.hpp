@@ -87,7 +87,10 @@ class Variant {
   template <int _i, class... Args>
   constexpr auto& emplace(Args&&... _args) {
     using T = internal::nth_element_t<_i, AlternativeTypes...>;
-    return emplace<T>(std::move(_args)...);
+    auto t = T{std::forward<Args>(_args)...};
+    destroy_if_necessary();
+    construct_alternative<_i>(std::move(t));
+    return *std::launder(reinterpret_cast<T*>(data_.data()));
   }
 
   /// Returns the index of the element currently held.
@@ -151,48 +154,20 @@ class Variant {
 
   template <class F>
   result_t<F> visit(F&& _f) {
-    using ResultType = result_t<F>;
-    if constexpr (std::is_same_v<ResultType, void>) {
-      bool visited = false;
-      do_visit_no_result(std::forward<F>(_f), &visited,
-                         std::make_integer_sequence<IndexType, size_>());
-    } else if constexpr (std::is_reference_v<ResultType>) {
-      std::remove_reference_t<ResultType>* res = nullptr;
-      do_visit_with_reference(std::forward<F>(_f), &res,
-                              std::make_integer_sequence<IndexType, size_>());
-      return *res;
-    } else {
-      auto res = std::optional<ResultType>();
-      do_visit_with_result(std::forward<F>(_f), &res,
-                           std::make_integer_sequence<IndexType, size_>());
-      return std::move(*res);
-    }
+    return do_visit<false, result_t<F>>(_f, *this);
   }
 
   template <class F>
   result_t<F> visit(F&& _f) const {
-    using ResultType = result_t<F>;
-    if constexpr (std::is_same_v<ResultType, void>) {
-      bool visited = false;
-      do_visit_no_result(std::forward<F>(_f), &visited,
-                         std::make_integer_sequence<IndexType, size_>());
-    } else if constexpr (std::is_reference_v<ResultType>) {
-      std::remove_reference_t<ResultType>* res = nullptr;
-      do_visit_with_reference(std::forward<F>(_f), &res,
-                              std::make_integer_sequence<IndexType, size_>());
-      return *res;
-    } else {
-      auto res = std::optional<ResultType>();
-      do_visit_with_result(std::forward<F>(_f), &res,
-                           std::make_integer_sequence<IndexType, size_>());
-      return std::move(*res);
-    }
+    return do_visit<false, result_t<F>>(_f, *this);
   }
 
  private:
   void copy_from_other(const Variant<AlternativeTypes...>& _other) {
-    const auto copy_one = [this](const auto& _t) { this->copy_from_type(_t); };
-    _other.visit(copy_one);
+    const auto copy_one = [this]<IndexType _i>(const auto& _t, Index<_i>) {
+      this->construct_alternative<_i>(_t);
+    };
+    do_visit<true, void>(copy_one, _other);
   }
 
   template <class T>
@@ -213,10 +188,16 @@ class Variant {
   template <class T>
   void copy_from_type(const T& _t) noexcept {
     using CurrentType = std::remove_cvref_t<decltype(_t)>;
-    index_ =
-        internal::element_index<CurrentType,
-                                std::remove_cvref_t<AlternativeTypes>...>();
-    new (data_.data()) CurrentType(_t);
+    construct_alternative<internal::element_index<
+        CurrentType, std::remove_cvref_t<AlternativeTypes>...>()>(_t);
+  }
+
+  /// Constructs the alternative signified by _i from _t.
+  template <IndexType _i, class T>
+  void construct_alternative(T&& _t) noexcept {
+    using CurrentType = internal::nth_element_t<_i, AlternativeTypes...>;
+    index_ = _i;
+    new (data_.data()) CurrentType(std::forward<T>(_t));
   }
 
   void destroy_if_necessary() {
@@ -229,156 +210,103 @@ class Variant {
     visit(destroy_one);
   }
 
-  template <class F, IndexType... _is>
-  void do_visit_no_result(F& _f, bool* _visited,
-                          std::integer_sequence<IndexType, _is...>) {
-    auto visit_one = [this]<IndexType _i>(const F& _f, bool* _visited,
-                                          Index<_i>) {
-      if (!*_visited && index_ == _i) {
-        _f(get_alternative<_i>());
-        *_visited = true;
-      }
-    };
-    (visit_one(_f, _visited, Index<_is>{}), ...);
-  }
-
-  template <class F, IndexType... _is>
-  void do_visit_no_result(F& _f, bool* _visited,
-                          std::integer_sequence<IndexType, _is...>) const {
-    auto visit_one = [this]<IndexType _i>(const F& _f, bool* _visited,
-                                          Index<_i>) {
-      if (!*_visited && index_ == _i) {
-        _f(get_alternative<_i>());
-        *_visited = true;
-      }
-    };
-    (visit_one(_f, _visited, Index<_is>{}), ...);
-  }
-
-  template <class F, IndexType... _is>
-  void do_visit_no_result(const F& _f, bool* _visited,
-                          std::integer_sequence<IndexType, _is...>) {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, bool* _visited,
-                                                Index<_i>) {
-      if (!*_visited && index_ == _i) {
-        _f(get_alternative<_i>());
-        *_visited = true;
-      }
-    };
-    (visit_one(_f, _visited, Index<_is>{}), ...);
-  }
-
-  template <class F, IndexType... _is>
-  void do_visit_no_result(const F& _f, bool* _visited,
-                          std::integer_sequence<IndexType, _is...>) const {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, bool* _visited,
-                                                Index<_i>) {
-      if (!*_visited && index_ == _i) {
-        _f(get_alternative<_i>());
-        *_visited = true;
-      }
-    };
-    (visit_one(_f, _visited, Index<_is>{}), ...);
-  }
-
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_result(F& _f, std::optional<ResultType>* _res,
-                            std::integer_sequence<IndexType, _is...>) {
-    auto visit_one = [this]<IndexType _i>(const F& _f,
-                                          std::optional<ResultType>* _res,
-                                          Index<_i>) {
-      if (!*_res && index_ == _i) {
-        _res->emplace(_f(get_alternative<_i>()));
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
-  }
-
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_result(F& _f, std::optional<ResultType>* _res,
-                            std::integer_sequence<IndexType, _is...>) const {
-    auto visit_one = [this]<IndexType _i>(const F& _f,
-                                          std::optional<ResultType>* _res,
-                                          Index<_i>) {
-      if (!*_res && index_ == _i) {
-        _res->emplace(_f(get_alternative<_i>()));
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
-  }
-
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_result(const F& _f, std::optional<ResultType>* _res,
-                            std::integer_sequence<IndexType, _is...>) {
-    const auto visit_one = [this]<IndexType _i>(const F& _f,
-                                                std::optional<ResultType>* _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        _res->emplace(_f(get_alternative<_i>()));
+  /// Calls _f on the alternative signified by _i. If _with_index is set,
+  /// the index is passed as well.
+  template <bool _with_index, class ResultType, IndexType _i, class F,
+            class V>
+  static ResultType visit_one(F& _f, V& _v) {
+    auto& alternative = _v.template get_alternative<_i>();
+    if constexpr (std::is_same_v<ResultType, void>) {
+      if constexpr (_with_index) {
+        _f(alternative, Index<_i>{});
+      } else {
+        _f(alternative);
       }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
+    } else if constexpr (_with_index) {
+      return static_cast<ResultType>(_f(alternative, Index<_i>{}));
+    } else {
+      return static_cast<ResultType>(_f(alternative));
+    }
   }
 
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_result(const F& _f, std::optional<ResultType>* _res,
-                            std::integer_sequence<IndexType, _is...>) const {
-    const auto visit_one = [this]<IndexType _i>(const F& _f,
-                                                std::optional<ResultType>* _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        _res->emplace(_f(get_alternative<_i>()));
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
+  /// Cases of visit_switch beyond the number of alternatives are never
+  /// reached, they only need to compile.
+  template <bool _with_index, class ResultType, IndexType _i, class F,
+            class V>
+  static ResultType visit_case(F& _f, V& _v) {
+    constexpr IndexType i = _i < size_ ? _i : size_ - 1;
+    return visit_one<_with_index, ResultType, i>(_f, _v);
+  }
+
+  /// Small variants are visited through a switch statement, which the
+  /// compiler turns into a jump table while still being able to inline the
+  /// visitor.
+  template <bool _with_index, class ResultType, class F, class V>
+  static ResultType visit_switch(F& _f, V& _v) {
+    switch (_v.index_) {
+      case 0:
+        return visit_case<_with_index, ResultType, 0>(_f, _v);
+      case 1:
+        return visit_case<_with_index, ResultType, 1>(_f, _v);
+      case 2:
+        return visit_case<_with_index, ResultType, 2>(_f, _v);
+      case 3:
+        return visit_case<_with_index, ResultType, 3>(_f, _v);
+      case 4:
+        return visit_case<_with_index, ResultType, 4>(_f, _v);
+      case 5:
+        return visit_case<_with_index, ResultType, 5>(_f, _v);
+      case 6:
+        return visit_case<_with_index, ResultType, 6>(_f, _v);
+      case 7:
+        return visit_case<_with_index, ResultType, 7>(_f, _v);
+      case 8:
+        return visit_case<_with_index, ResultType, 8>(_f, _v);
+      case 9:
+        return visit_case<_with_index, ResultType, 9>(_f, _v);
+      case 10:
+        return visit_case<_with_index, ResultType, 10>(_f, _v);
+      case 11:
+        return visit_case<_with_index, ResultType, 11>(_f, _v);
+      case 12:
+        return visit_case<_with_index, ResultType, 12>(_f, _v);
+      case 13:
+        return visit_case<_with_index, ResultType, 13>(_f, _v);
+      case 14:
+        return visit_case<_with_index, ResultType, 14>(_f, _v);
+      case 15:
+        return visit_case<_with_index, ResultType, 15>(_f, _v);
+      default:
+        return visit_case<_with_index, ResultType, size_ - 1>(_f, _v);
+    }
   }
 
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_reference(F& _f, ResultType** _res,
-                               std::integer_sequence<IndexType, _is...>) {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, ResultType** _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        *_res = &_f(get_alternative<_i>());
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
+  template <bool _with_index, class ResultType, class F, class V,
+            IndexType... _is>
+  static constexpr auto make_visit_table(
+      std::integer_sequence<IndexType, _is...>) {
+    return std::array<ResultType (*)(F&, V&), size_>{
+        &visit_one<_with_index, ResultType, _is, F, V>...};
   }
 
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_reference(F& _f, ResultType** _res,
-                               std::integer_sequence<IndexType, _is...>) const {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, ResultType** _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        *_res = &_f(get_alternative<_i>());
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
-  }
+  /// A table of functions, one for every alternative, which is indexed by
+  /// index_.
+  template <bool _with_index, class ResultType, class F, class V>
+  static constexpr auto visit_table_ =
+      make_visit_table<_with_index, ResultType, F, V>(
+          std::make_integer_sequence<IndexType, size_>());
 
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_reference(const F& _f, ResultType** _res,
-                               std::integer_sequence<IndexType, _is...>) {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, ResultType** _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        *_res = &_f(get_alternative<_i>());
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
-  }
+  /// Variants with more alternatives than this are visited through a table
+  /// of function pointers.
+  static constexpr IndexType max_switch_size_ = 16;
 
-  template <class F, class ResultType, IndexType... _is>
-  void do_visit_with_reference(const F& _f, ResultType** _res,
-                               std::integer_sequence<IndexType, _is...>) const {
-    const auto visit_one = [this]<IndexType _i>(const F& _f, ResultType** _res,
-                                                Index<_i>) {
-      if (!*_res && index_ == _i) {
-        *_res = &_f(get_alternative<_i>());
-      }
-    };
-    (visit_one(_f, _res, Index<_is>{}), ...);
+  template <bool _with_index, class ResultType, class F, class V>
+  static ResultType do_visit(F& _f, V& _v) {
+    if constexpr (size_ <= max_switch_size_) {
+      return visit_switch<_with_index, ResultType>(_f, _v);
+    } else {
+      return visit_table_<_with_index, ResultType, F, V>[_v.index_](_f, _v);
+    }
   }
 
   template <IndexType _i>
@@ -394,19 +322,18 @@ class Variant {
   }
 
   void move_from_other(Variant<AlternativeTypes...>&& _other) noexcept {
-    const auto move_one = [this](auto&& _t) {
-      this->move_from_type(std::forward<std::remove_cvref_t<decltype(_t)>>(_t));
+    const auto move_one = [this]<IndexType _i>(auto& _t, Index<_i>) {
+      this->construct_alternative<_i>(std::move(_t));
     };
-    std::forward<Variant<AlternativeTypes...>>(_other).visit(move_one);
+    do_visit<true, void>(move_one, _other);
   }
 
   template <class T>
   void move_from_type(T&& _t) noexcept {
     using CurrentType = std::remove_cvref_t<decltype(_t)>;
-    index_ =
-        internal::element_index<CurrentType,
-                                std::remove_cvref_t<AlternativeTypes>...>();
-    new (data_.data()) CurrentType(std::forward<T>(_t));
+    construct_alternative<internal::element_index<
+        CurrentType, std::remove_cvref_t<AlternativeTypes>...>()>(
+        std::forward<T>(_t));
   }
 
  private:
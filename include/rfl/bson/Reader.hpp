@@ -45,6 +45,8 @@ struct Reader {
   using InputObjectType = BSONInputObject;
   using InputVarType = BSONInputVar;
 
+  static constexpr bool supports_string_views_ = true;
+
   template <class T>
   static constexpr bool has_custom_constructor = (requires(InputVarType var) {
     T::from_bson_obj(var);
@@ -70,6 +72,19 @@ struct Reader {
         case BSON_TYPE_SYMBOL:
           return std::string(value.v_symbol.symbol, value.v_symbol.len);
 
+        default:
+          return rfl::Error(
+              "Could not cast to string. The type must be UTF8 or symbol.");
+      }
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      switch (btype) {
+        case BSON_TYPE_UTF8:
+          return std::string_view(value.v_utf8.str, value.v_utf8.len);
+
+        case BSON_TYPE_SYMBOL:
+          return std::string_view(value.v_symbol.symbol, value.v_symbol.len);
+
         default:
           return rfl::Error(
               "Could not cast to string. The type must be UTF8 or symbol.");
@@ -87,6 +102,19 @@ struct Reader {
       return rfl::Bytestring(
           std::bit_cast<const std::byte*>(value.v_binary.data),
           value.v_binary.data_len);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      rfl::BytestringView>()) {
+      if (btype != BSON_TYPE_BINARY) {
+        return rfl::Error("Could not cast to bytestring.");
+      }
+      if (value.v_binary.subtype != BSON_SUBTYPE_BINARY) {
+        return rfl::Error(
+            "The BSON subtype must be a binary in order to read into a "
+            "bytestring.");
+      }
+      return rfl::BytestringView(
+          std::bit_cast<const std::byte*>(value.v_binary.data),
+          value.v_binary.data_len);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       if (btype != BSON_TYPE_BOOL) {
         return rfl::Error("Could not cast to boolean.");
@@ -7,8 +7,11 @@
 #include <istream>
 #include <string>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/BorrowFromDocument.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -59,6 +62,79 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses an BSON object using reflection. Unlike read(...), this supports
+/// fields of type std::string_view and rfl::BytestringView, which point
+/// directly into _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const uint8_t* _bytes, const size_t _size) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  return read<T, Ps..., internal::BorrowFromDocument>(_bytes, _size)
+      .transform([](U&& _u) {
+        return Borrowed<U>(Borrowed<U>::no_document(), std::move(_u));
+      });
+}
+
+/// Parses an BSON object using reflection. Unlike read(...), this supports
+/// fields of type std::string_view and rfl::BytestringView, which point
+/// directly into _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+auto read_borrowed(const char* _bytes, const size_t _size) {
+  return read_borrowed<T, Ps...>(std::bit_cast<const uint8_t*>(_bytes), _size);
+}
+
+/// Parses an BSON object using reflection. Unlike read(...), this supports
+/// fields of type std::string_view and rfl::BytestringView, which point
+/// directly into _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+auto read_borrowed(const std::vector<char>& _bytes) {
+  return read_borrowed<T, Ps...>(_bytes.data(), _bytes.size());
+}
+
+/// Parses a BSON var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses BSON into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const uint8_t* _bytes, const size_t _size) {
+  bson_value_t val;
+  val.value.v_doc.data_len = static_cast<uint32_t>(_size);
+  val.value.v_doc.data = const_cast<uint8_t*>(_bytes);
+  val.value_type = BSON_TYPE_DOCUMENT;
+  return read_into<Ps...>(_obj, Reader::InputVarType{&val});
+}
+
+/// Parses BSON into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const char* _bytes, const size_t _size) {
+  return read_into<Ps...>(_obj, std::bit_cast<const uint8_t*>(_bytes), _size);
+}
+
+/// Parses BSON into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_obj, _bytes.data(), _bytes.size());
+}
+
 }  // namespace bson
 }  // namespace rfl
 
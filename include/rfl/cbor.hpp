@@ -4,9 +4,11 @@
 #include "../rfl.hpp"
 #include "cbor/Parser.hpp"
 #include "cbor/Reader.hpp"
+#include "cbor/TypedArrays.hpp"
 #include "cbor/Writer.hpp"
 #include "cbor/load.hpp"
 #include "cbor/read.hpp"
+#include "cbor/read_many.hpp"
 #include "cbor/save.hpp"
 #include "cbor/write.hpp"
 
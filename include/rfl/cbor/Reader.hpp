@@ -3,38 +3,61 @@
 
 #include <cbor.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../Bytestring.hpp"
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "TypedArrays.hpp"
 
 namespace rfl {
 namespace cbor {
 
 /// Please refer to https://intel.github.io/tinycbor/current/index.html
+///
+/// tinycbor can only skip a container by walking through all of its elements.
+/// To avoid doing that for every level of nesting, each value carries a
+/// pointer to the iterator of the enclosing container. Once a nested container
+/// has been read completely, that iterator is moved past it directly.
 struct Reader {
+  /// Typed arrays (RFC 8746) are byte strings, so they are not represented
+  /// by the CborValue itself, but by typed_tag_ and typed_data_.
   struct CBORInputArray {
     CborValue val_;
+    CborValue* cursor_ = nullptr;
+    CborTag typed_tag_ = 0;
+    std::span<const uint8_t> typed_data_;
   };
 
   struct CBORInputObject {
     CborValue val_;
+    CborValue* cursor_ = nullptr;
   };
 
   struct CBORInputVar {
     CborValue val_;
+    CborValue* cursor_ = nullptr;
   };
 
   using InputArrayType = CBORInputArray;
   using InputObjectType = CBORInputObject;
   using InputVarType = CBORInputVar;
 
+  static constexpr bool supports_string_views_ = true;
+
   template <class T>
   static constexpr bool has_custom_constructor = (requires(InputVarType var) {
     T::from_cbor_obj(var);
@@ -46,8 +69,82 @@ struct Reader {
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType& _obj) const noexcept;
 
+  std::optional<std::pair<std::string_view, InputVarType>> get_first_field(
+      const InputObjectType& _obj) const noexcept;
+
   bool is_empty(const InputVarType& _var) const noexcept;
 
+  /// Only the size of typed arrays is known in advance, because the length
+  /// of a regular array has not been validated yet.
+  size_t size_hint(const InputArrayType& _arr) const noexcept;
+
+  template <class T>
+  size_t read_numbers(const InputArrayType& _arr,
+                      const std::span<T> _out) const noexcept {
+    switch (_arr.typed_tag_) {
+      case 64:
+      case 68:
+        return read_typed<std::uint8_t>(_arr, false, _out);
+      case 65:
+        return read_typed<std::uint16_t>(_arr, false, _out);
+      case 66:
+        return read_typed<std::uint32_t>(_arr, false, _out);
+      case 67:
+        return read_typed<std::uint64_t>(_arr, false, _out);
+      case 69:
+        return read_typed<std::uint16_t>(_arr, true, _out);
+      case 70:
+        return read_typed<std::uint32_t>(_arr, true, _out);
+      case 71:
+        return read_typed<std::uint64_t>(_arr, true, _out);
+      case 72:
+        return read_typed<std::int8_t>(_arr, false, _out);
+      case 73:
+        return read_typed<std::int16_t>(_arr, false, _out);
+      case 74:
+        return read_typed<std::int32_t>(_arr, false, _out);
+      case 75:
+        return read_typed<std::int64_t>(_arr, false, _out);
+      case 77:
+        return read_typed<std::int16_t>(_arr, true, _out);
+      case 78:
+        return read_typed<std::int32_t>(_arr, true, _out);
+      case 79:
+        return read_typed<std::int64_t>(_arr, true, _out);
+      case 81:
+        return read_typed<float>(_arr, false, _out);
+      case 82:
+        return read_typed<double>(_arr, false, _out);
+      case 85:
+        return read_typed<float>(_arr, true, _out);
+      case 86:
+        return read_typed<double>(_arr, true, _out);
+      default:
+        return 0;
+    }
+  }
+
+  /// Views a typed array in place, which is only possible, if its elements
+  /// are stored as exactly T in native byte order.
+  template <class T>
+  rfl::Result<std::span<const T>> view_numbers(
+      const InputArrayType& _arr) const noexcept {
+    constexpr auto tag = typed_array_tag<T>();
+    if (tag == 0 || _arr.typed_tag_ != tag) {
+      return rfl::Error(
+          "Could not view the array, because it is not a typed array with "
+          "elements of the expected type.");
+    }
+    const auto ptr = _arr.typed_data_.data();
+    if (reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) != 0) {
+      return rfl::Error(
+          "Could not view the array, because the underlying buffer is not "
+          "properly aligned.");
+    }
+    return std::span<const T>(reinterpret_cast<const T*>(ptr),
+                              _arr.typed_data_.size() / sizeof(T));
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
@@ -60,6 +157,18 @@ struct Reader {
         return Error(cbor_error_string(err));
       }
       return str;
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      if (!cbor_value_is_text_string(&_var.val_)) {
+        return Error("Could not cast to string.");
+      }
+      const char* ptr = nullptr;
+      size_t size = 0;
+      const auto err = get_string_view(&_var.val_, &ptr, &size);
+      if (err != CborNoError) {
+        return Error(cbor_error_string(err));
+      }
+      return std::string_view(ptr, size);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       if (!cbor_value_is_byte_string(&_var.val_)) {
@@ -71,6 +180,18 @@ struct Reader {
         return Error(cbor_error_string(err));
       }
       return bstr;
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      rfl::BytestringView>()) {
+      if (!cbor_value_is_byte_string(&_var.val_)) {
+        return Error("Could not cast to bytestring.");
+      }
+      const uint8_t* ptr = nullptr;
+      size_t size = 0;
+      const auto err = get_bytestring_view(&_var.val_, &ptr, &size);
+      if (err != CborNoError) {
+        return Error(cbor_error_string(err));
+      }
+      return rfl::BytestringView(std::bit_cast<const std::byte*>(ptr), size);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       if (!cbor_value_is_boolean(&_var.val_)) {
         return rfl::Error("Could not cast to boolean.");
@@ -123,61 +244,76 @@ struct Reader {
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
-    InputVarType var;
-    auto buffer = std::vector<char>();
-    auto err = cbor_value_enter_container(&_arr.val_, &var.val_);
-    if (err != CborNoError && err != CborErrorOutOfMemory) {
-      return Error(cbor_error_string(err));
+    if (_arr.typed_tag_ != 0) {
+      // An empty typed array has no elements to read, so it can be read
+      // into any container, just like an empty regular array. The bulk path
+      // is not taken in that case, because the size hint is zero.
+      if (_arr.typed_data_.empty()) {
+        return std::nullopt;
+      }
+      return Error(
+          "Typed arrays can only be read into std::vector, std::array or "
+          "std::span of numbers with a matching size.");
     }
-    size_t length = 0;
-    err = cbor_value_get_array_length(&_arr.val_, &length);
-    if (err != CborNoError && err != CborErrorOutOfMemory) {
+    CborValue it;
+    auto err = cbor_value_enter_container(&_arr.val_, &it);
+    if (err != CborNoError) {
       return Error(cbor_error_string(err));
     }
-    for (size_t i = 0; i < length; ++i) {
-      const auto err2 = _array_reader.read(var);
+    while (!cbor_value_at_end(&it)) {
+      const auto pos = cbor_value_get_next_byte(&it);
+      const auto err2 = _array_reader.read(InputVarType{it, &it});
       if (err2) {
         return err2;
       }
-      err = cbor_value_advance(&var.val_);
-      if (err != CborNoError && err != CborErrorOutOfMemory) {
+      err = skip_if_unread(pos, &it);
+      if (err != CborNoError) {
         return Error(cbor_error_string(err));
       }
     }
+    err = leave_container(_arr.val_, it, _arr.cursor_);
+    if (err != CborNoError) {
+      return Error(cbor_error_string(err));
+    }
     return std::nullopt;
   }
 
   template <class ObjectReader>
   std::optional<Error> read_object(const ObjectReader& _object_reader,
                                    const InputObjectType& _obj) const noexcept {
-    size_t length = 0;
-    auto err = cbor_value_get_map_length(&_obj.val_, &length);
-    if (err != CborNoError) {
-      return Error(cbor_error_string(err));
-    }
-
-    InputVarType var;
-    err = cbor_value_enter_container(&_obj.val_, &var.val_);
+    CborValue it;
+    auto err = cbor_value_enter_container(&_obj.val_, &it);
     if (err != CborNoError) {
       return Error(cbor_error_string(err));
     }
 
     auto buffer = std::string();
 
-    for (size_t i = 0; i < length; ++i) {
-      err = get_string(&var.val_, &buffer);
+    while (!cbor_value_at_end(&it)) {
+      if (!cbor_value_is_text_string(&it)) {
+        return Error("Expected the key to be a string value.");
+      }
+      err = get_string(&it, &buffer);
       if (err != CborNoError) {
         return Error(cbor_error_string(err));
       }
-      err = cbor_value_advance(&var.val_);
+      err = cbor_value_advance(&it);
       if (err != CborNoError) {
         return Error(cbor_error_string(err));
       }
       const auto name = std::string_view(buffer);
-      _object_reader.read(name, var);
-      cbor_value_advance(&var.val_);
+      const auto pos = cbor_value_get_next_byte(&it);
+      _object_reader.read(name, InputVarType{it, &it});
+      err = skip_if_unread(pos, &it);
+      if (err != CborNoError) {
+        return Error(cbor_error_string(err));
+      }
     }
 
+    err = leave_container(_obj.val_, it, _obj.cursor_);
+    if (err != CborNoError) {
+      return Error(cbor_error_string(err));
+    }
     return std::nullopt;
   }
 
@@ -192,11 +328,63 @@ struct Reader {
   }
 
  private:
+  /// Copies the elements of a typed array, which are stored as E, into _out
+  /// and returns the number of elements copied.
+  template <class E, class T>
+  static size_t read_typed(const InputArrayType& _arr,
+                           const bool _little_endian,
+                           const std::span<T> _out) noexcept {
+    const auto size =
+        std::min(_out.size(), _arr.typed_data_.size() / sizeof(E));
+    const bool swap =
+        _little_endian != (std::endian::native == std::endian::little);
+    if constexpr (std::is_same_v<E, T>) {
+      if (!swap) {
+        std::memcpy(_out.data(), _arr.typed_data_.data(), size * sizeof(E));
+        return size;
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      std::array<uint8_t, sizeof(E)> bytes;
+      std::memcpy(bytes.data(), _arr.typed_data_.data() + i * sizeof(E),
+                  sizeof(E));
+      if (swap) {
+        std::reverse(bytes.begin(), bytes.end());
+      }
+      _out[i] = static_cast<T>(std::bit_cast<E>(bytes));
+    }
+    return size;
+  }
+
+  /// Enters the byte string of a typed array, which must directly follow
+  /// _var, if _var is tagged as one.
+  rfl::Result<InputArrayType> to_typed_array(
+      const InputVarType& _var) const noexcept;
+
+  /// The size of the elements of a typed array with tag _tag, or 0, if the
+  /// tag does not belong to a supported typed array.
+  static size_t typed_array_element_size(const CborTag _tag) noexcept;
+
   CborError get_bytestring(const CborValue* _ptr,
                            rfl::Bytestring* _str) const noexcept;
 
+  CborError get_bytestring_view(const CborValue* _ptr, const uint8_t** _data,
+                                size_t* _size) const noexcept;
+
   CborError get_string(const CborValue* _ptr,
                        std::string* _str) const noexcept;
+
+  CborError get_string_view(const CborValue* _ptr, const char** _data,
+                            size_t* _size) const noexcept;
+
+  /// Moves _cursor, the iterator of the enclosing container, past
+  /// _container, which has been read up to _it.
+  CborError leave_container(const CborValue& _container, const CborValue& _it,
+                            CborValue* _cursor) const noexcept;
+
+  /// Advances _it, unless the element at _pos has already been consumed by
+  /// the child parser.
+  CborError skip_if_unread(const uint8_t* _pos, CborValue* _it) const noexcept;
 };
 
 }  // namespace cbor
@@ -0,0 +1,53 @@
+#ifndef RFL_CBOR_TYPEDARRAYS_HPP_
+#define RFL_CBOR_TYPEDARRAYS_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace rfl {
+namespace cbor {
+
+/// This is a "fake" processor - it doesn't do much in itself, but its
+/// inclusion instructs the CBOR writer to encode arrays of numbers, such as
+/// std::vector<float>, as typed arrays (RFC 8746): a single byte string
+/// tagged with the type and endianness of its elements. The reader always
+/// accepts typed arrays, whether this processor is passed or not.
+struct TypedArrays {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+/// The RFC 8746 tag for a typed array containing elements of type T in
+/// native byte order, or 0, if there is none.
+template <class T>
+constexpr std::uint64_t typed_array_tag() {
+  constexpr bool little = std::endian::native == std::endian::little;
+  constexpr bool big = std::endian::native == std::endian::big;
+  constexpr std::uint64_t endian = little ? 4 : 0;
+  if constexpr (!little && !big) {
+    return 0;
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) <= 8) {
+    constexpr std::uint64_t ll = std::bit_width(sizeof(T)) - 1;
+    constexpr std::uint64_t s = std::is_signed_v<T> ? 8 : 0;
+    return 64 | s | (sizeof(T) == 1 ? 0 : endian) | ll;
+  } else if constexpr (std::is_same_v<T, float> && sizeof(T) == 4) {
+    return 81 | endian;
+  } else if constexpr (std::is_same_v<T, double> && sizeof(T) == 8) {
+    return 82 | endian;
+  } else {
+    return 0;
+  }
+}
+
+template <class... Ps>
+constexpr bool has_typed_arrays_v =
+    std::disjunction_v<std::is_same<Ps, TypedArrays>...>;
+
+}  // namespace cbor
+}  // namespace rfl
+
+#endif
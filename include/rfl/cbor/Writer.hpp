@@ -4,8 +4,10 @@
 #include <cbor.h>
 
 #include <bit>
+#include <cstdint>
 #include <exception>
 #include <map>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -19,6 +21,7 @@
 #include "../Ref.hpp"
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "TypedArrays.hpp"
 
 namespace rfl {
 namespace cbor {
@@ -41,7 +44,11 @@ class Writer {
   using OutputObjectType = CBOROutputObject;
   using OutputVarType = CBOROutputVar;
 
-  Writer(CborEncoder* _encoder);
+  static constexpr bool supports_string_view_values_ = true;
+
+  /// If _typed_arrays is set, arrays of numbers are written as typed arrays
+  /// (RFC 8746) instead of arrays of individual items.
+  Writer(CborEncoder* _encoder, const bool _typed_arrays = false);
 
   ~Writer();
 
@@ -51,6 +58,12 @@ class Writer {
 
   OutputVarType null_as_root() const noexcept;
 
+  template <class T>
+  OutputVarType numbers_as_root(
+      const std::span<const T> _numbers) const noexcept {
+    return new_numbers(_numbers, encoder_);
+  }
+
   template <class T>
   OutputVarType value_as_root(const T& _var) const noexcept {
     return new_value(_var, encoder_);
@@ -84,6 +97,21 @@ class Writer {
     return new_value(_var, _parent->encoder_);
   }
 
+  template <class T>
+  OutputVarType add_numbers_to_array(
+      const std::span<const T> _numbers,
+      OutputArrayType* _parent) const noexcept {
+    return new_numbers(_numbers, _parent->encoder_);
+  }
+
+  template <class T>
+  OutputVarType add_numbers_to_object(
+      const std::string_view& _name, const std::span<const T> _numbers,
+      OutputObjectType* _parent) const noexcept {
+    cbor_encode_text_string(_parent->encoder_, _name.data(), _name.size());
+    return new_numbers(_numbers, _parent->encoder_);
+  }
+
   OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
 
   OutputVarType add_null_to_object(const std::string_view& _name,
@@ -100,10 +128,31 @@ class Writer {
   OutputObjectType new_object(const size_t _size,
                               CborEncoder* _parent) const noexcept;
 
+  template <class T>
+  OutputVarType new_numbers(const std::span<const T> _numbers,
+                            CborEncoder* _parent) const noexcept {
+    constexpr auto tag = typed_array_tag<T>();
+    if (tag != 0 && typed_arrays_) {
+      cbor_encode_tag(_parent, tag);
+      cbor_encode_byte_string(_parent,
+                              reinterpret_cast<const uint8_t*>(_numbers.data()),
+                              _numbers.size_bytes());
+    } else {
+      CborEncoder arr;
+      cbor_encoder_create_array(_parent, &arr, _numbers.size());
+      for (const auto& n : _numbers) {
+        new_value(n, &arr);
+      }
+      cbor_encoder_close_container(_parent, &arr);
+    }
+    return OutputVarType{};
+  }
+
   template <class T>
   OutputVarType new_value(const T& _var, CborEncoder* _parent) const noexcept {
-    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      cbor_encode_text_string(_parent, _var.c_str(), _var.size());
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      cbor_encode_text_string(_parent, _var.data(), _var.size());
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       cbor_encode_byte_string(
@@ -124,6 +173,9 @@ class Writer {
   /// The underlying TinyCBOR encoder.
   CborEncoder* const encoder_;
 
+  /// Whether arrays of numbers are written as typed arrays.
+  const bool typed_arrays_;
+
   /// Contain all of the subobjects and subarrays.
   const rfl::Box<std::vector<rfl::Box<CborEncoder>>> subencoders_;
 };
@@ -3,7 +3,7 @@
 
 #include "../Processors.hpp"
 #include "../Result.hpp"
-#include "../io/load_bytes.hpp"
+#include "../io/MappedFile.hpp"
 #include "read.hpp"
 
 namespace rfl {
@@ -11,10 +11,10 @@ namespace cbor {
 
 template <class T, class... Ps>
 Result<T> load(const std::string& _fname) {
-  const auto read_bytes = [](const auto& _bytes) {
-    return read<T, Ps...>(_bytes);
+  const auto read_file = [](const auto& _file) {
+    return read<T, Ps...>(_file.data(), _file.size());
   };
-  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+  return rfl::io::MappedFile::open(_fname).and_then(read_file);
 }
 
 }  // namespace cbor
@@ -7,8 +7,11 @@
 #include <istream>
 #include <string>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/BorrowFromDocument.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -51,6 +54,62 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses an object from CBOR using reflection. Unlike read(...), this
+/// supports fields of type std::string_view and rfl::BytestringView, which
+/// point directly into _bytes, so _bytes must outlive the object. Strings of
+/// indefinite length cannot be read into views.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const char* _bytes, const size_t _size) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  return read<T, Ps..., internal::BorrowFromDocument>(_bytes, _size)
+      .transform([](U&& _u) {
+        return Borrowed<U>(Borrowed<U>::no_document(), std::move(_u));
+      });
+}
+
+/// Parses an object from CBOR using reflection. Unlike read(...), this
+/// supports fields of type std::string_view and rfl::BytestringView, which
+/// point directly into _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+auto read_borrowed(const std::vector<char>& _bytes) {
+  return read_borrowed<T, Ps...>(_bytes.data(), _bytes.size());
+}
+
+/// Parses a CBOR var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses CBOR into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const char* _bytes, const size_t _size) {
+  CborParser parser;
+  InputVarType doc;
+  cbor_parser_init(std::bit_cast<const uint8_t*>(_bytes), _size, 0, &parser,
+                   &doc.val_);
+  return read_into<Ps...>(_obj, doc);
+}
+
+/// Parses CBOR into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_obj, _bytes.data(), _bytes.size());
+}
+
 }  // namespace cbor
 }  // namespace rfl
 
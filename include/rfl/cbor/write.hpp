@@ -12,6 +12,7 @@
 
 #include "../parsing/Parent.hpp"
 #include "Parser.hpp"
+#include "TypedArrays.hpp"
 
 namespace rfl {
 namespace cbor {
@@ -23,7 +24,7 @@ void write_into_buffer(const auto& _obj, CborEncoder* _encoder,
   using ParentType = parsing::Parent<Writer>;
   cbor_encoder_init(_encoder, std::bit_cast<uint8_t*>(_buffer->data()),
                     _buffer->size(), 0);
-  const auto writer = Writer(_encoder);
+  const auto writer = Writer(_encoder, has_typed_arrays_v<Ps...>);
   Parser<T, Processors<Ps...>>::write(writer, _obj,
                                       typename ParentType::Root{});
 }
@@ -1,7 +1,9 @@
 #ifndef RFL_ENUMS_HPP_
 #define RFL_ENUMS_HPP_
 
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "Result.hpp"
 #include "internal/enums/StringConverter.hpp"
@@ -17,9 +19,18 @@ std::string enum_to_string(EnumType _enum) {
   return rfl::internal::enums::StringConverter<EnumType>::enum_to_string(_enum);
 }
 
+// Returns the name of the enumerator matching the enum value without
+// allocating, or std::nullopt if there is no such enumerator. Unlike
+// enum_to_string, this does not combine the flags of flag enums.
+template <internal::enums::is_scoped_enum EnumType>
+constexpr std::optional<std::string_view> enum_to_string_view(EnumType _enum) {
+  return rfl::internal::enums::StringConverter<EnumType>::enum_to_string_view(
+      _enum);
+}
+
 // Converts a string to a value of the given enum type.
 template <internal::enums::is_scoped_enum EnumType>
-rfl::Result<EnumType> string_to_enum(const std::string& _str) {
+rfl::Result<EnumType> string_to_enum(const std::string_view _str) {
   return rfl::internal::enums::StringConverter<EnumType>::string_to_enum(_str);
 }
 
@@ -7,6 +7,7 @@
 #include "flexbuf/Writer.hpp"
 #include "flexbuf/load.hpp"
 #include "flexbuf/read.hpp"
+#include "flexbuf/read_many.hpp"
 #include "flexbuf/save.hpp"
 #include "flexbuf/write.hpp"
 
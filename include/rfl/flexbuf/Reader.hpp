@@ -3,10 +3,15 @@
 
 #include <flatbuffers/flexbuffers.h>
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <map>
+#include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -22,7 +27,14 @@ namespace rfl {
 namespace flexbuf {
 
 struct Reader {
-  using InputArrayType = flexbuffers::Vector;
+  /// Either a vector or a typed vector. flexbuffers uses typed vectors for
+  /// arrays of scalars, which store the elements packed and without any type
+  /// information of their own.
+  struct FlexbufInputArray {
+    flexbuffers::Reference val_;
+  };
+
+  using InputArrayType = FlexbufInputArray;
   using InputObjectType = flexbuffers::Map;
   using InputVarType = flexbuffers::Reference;
 
@@ -52,6 +64,57 @@ struct Reader {
 
   bool is_empty(const InputVarType& _var) const noexcept;
 
+  size_t size_hint(const InputArrayType& _arr) const noexcept;
+
+  size_t size_hint(const InputObjectType& _obj) const noexcept;
+
+  template <class T>
+  size_t read_numbers(const InputArrayType& _arr,
+                      const std::span<T> _out) const noexcept {
+    if (const auto packed = get_packed<T>(_arr)) {
+      const auto size = std::min(packed->size(), _out.size());
+      std::memcpy(_out.data(), packed->data(), size * sizeof(T));
+      return size;
+    }
+    return with_vector(_arr, [&](const auto& _vec) -> size_t {
+      const auto size = std::min(static_cast<size_t>(_vec.size()),
+                                 _out.size());
+      for (size_t i = 0; i < size; ++i) {
+        const auto var = _vec[i];
+        if (!var.IsNumeric()) {
+          return i;
+        }
+        if constexpr (std::is_floating_point<T>()) {
+          _out[i] = static_cast<T>(var.AsDouble());
+        } else {
+          _out[i] = static_cast<T>(var.AsInt64());
+        }
+      }
+      return size;
+    });
+  }
+
+  /// Views a typed vector in place, which is only possible, if the elements
+  /// are stored as exactly T.
+  template <class T>
+  rfl::Result<std::span<const T>> view_numbers(
+      const InputArrayType& _arr) const noexcept {
+    const auto packed = get_packed<T>(_arr);
+    if (!packed) {
+      return rfl::Error(
+          "Could not view the array, because it is not a typed vector with "
+          "elements of the expected type.");
+    }
+    const auto ptr = packed->data();
+    if (reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) != 0) {
+      return rfl::Error(
+          "Could not view the array, because the underlying buffer is not "
+          "properly aligned.");
+    }
+    return std::span<const T>(reinterpret_cast<const T*>(ptr),
+                              packed->size());
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
@@ -90,14 +153,16 @@ struct Reader {
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
-    const auto size = _arr.size();
-    for (size_t i = 0; i < size; ++i) {
-      const auto err = _array_reader.read(InputVarType(_arr[i]));
-      if (err) {
-        return err;
+    return with_vector(_arr, [&](const auto& _vec) -> std::optional<Error> {
+      const auto size = _vec.size();
+      for (size_t i = 0; i < size; ++i) {
+        const auto err = _array_reader.read(InputVarType(_vec[i]));
+        if (err) {
+          return err;
+        }
       }
-    }
-    return std::nullopt;
+      return std::nullopt;
+    });
   }
 
   template <class ObjectReader>
@@ -129,6 +194,53 @@ struct Reader {
       return rfl::Error(e.what());
     }
   }
+
+ private:
+  /// Gives access to the packed elements of a typed vector.
+  class PackedVector : public flexbuffers::TypedVector {
+   public:
+    explicit PackedVector(const flexbuffers::TypedVector& _vec)
+        : flexbuffers::TypedVector(_vec) {}
+
+    const uint8_t* data() const { return data_; }
+
+    size_t byte_width() const { return byte_width_; }
+  };
+
+  /// Returns the typed vector, if its elements are stored exactly like T, so
+  /// they can be copied or viewed without any conversion.
+  template <class T>
+  std::optional<PackedVector> get_packed(
+      const InputArrayType& _arr) const noexcept {
+    if constexpr (std::endian::native != std::endian::little) {
+      return std::nullopt;
+    } else {
+      if (!_arr.val_.IsTypedVector()) {
+        return std::nullopt;
+      }
+      const auto type =
+          flexbuffers::ToTypedVectorElementType(_arr.val_.GetType());
+      const auto expected =
+          std::is_floating_point<T>()
+              ? flexbuffers::FBT_FLOAT
+              : (std::is_unsigned<T>() ? flexbuffers::FBT_UINT
+                                       : flexbuffers::FBT_INT);
+      const auto packed = PackedVector(_arr.val_.AsTypedVector());
+      if (type != expected || packed.byte_width() != sizeof(T)) {
+        return std::nullopt;
+      }
+      return packed;
+    }
+  }
+
+  /// Calls _f with either the vector or the typed vector underlying _arr.
+  template <class F>
+  auto with_vector(const InputArrayType& _arr, const F& _f) const {
+    if (_arr.val_.IsTypedVector()) {
+      return _f(_arr.val_.AsTypedVector());
+    }
+    return _f(_arr.val_.AsVector());
+  }
 };
 
 }  // namespace flexbuf
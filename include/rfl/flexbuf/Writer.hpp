@@ -4,10 +4,13 @@
 #include <flatbuffers/flexbuffers.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <map>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -80,6 +83,28 @@ struct Writer {
     return insert_value(_name, _var);
   }
 
+  /// Arrays of numbers are written as typed vectors, which store the
+  /// elements packed.
+  template <class T>
+  OutputVarType add_numbers_to_array(const std::span<const T> _numbers,
+                                     OutputArrayType* _parent) const noexcept {
+    return insert_numbers(_numbers);
+  }
+
+  template <class T>
+  OutputVarType add_numbers_to_object(
+      const std::string_view& _name, const std::span<const T> _numbers,
+      OutputObjectType* _parent) const noexcept {
+    fbb_->Key(_name.data());
+    return insert_numbers(_numbers);
+  }
+
+  template <class T>
+  OutputVarType numbers_as_root(
+      const std::span<const T> _numbers) const noexcept {
+    return insert_numbers(_numbers);
+  }
+
   OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
 
   OutputVarType add_null_to_object(const std::string_view& _name,
@@ -129,6 +154,28 @@ struct Writer {
     return OutputVarType{};
   }
 
+  template <class T>
+  OutputVarType insert_numbers(
+      const std::span<const T> _numbers) const noexcept {
+    // flexbuffers stores the size of a typed vector with the same width as
+    // its elements, so small types can only be written as such, if the size
+    // fits. Otherwise, we let flexbuffers choose a wider type.
+    constexpr auto max_size =
+        sizeof(T) < sizeof(uint64_t)
+            ? (static_cast<uint64_t>(1) << (8 * sizeof(T))) - 1
+            : std::numeric_limits<uint64_t>::max();
+    if (_numbers.size() <= max_size) {
+      fbb_->Vector(_numbers.data(), _numbers.size());
+    } else {
+      const auto start = fbb_->StartVector();
+      for (const auto& n : _numbers) {
+        insert_value(n);
+      }
+      fbb_->EndVector(start, true, false);
+    }
+    return OutputVarType{};
+  }
+
   OutputArrayType new_array(const std::string_view& _name) const noexcept;
 
   OutputArrayType new_array() const noexcept;
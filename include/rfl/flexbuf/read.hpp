@@ -7,8 +7,12 @@
 #include <istream>
 #include <vector>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
 #include "../Result.hpp"
+#include "../internal/BorrowFromDocument.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 
 namespace rfl {
@@ -37,6 +41,28 @@ auto read(const std::vector<char>& _bytes) {
   return read<T, Ps...>(_bytes.data(), _bytes.size());
 }
 
+/// Parses an object from flexbuf using reflection. Unlike read(...), this
+/// supports fields of type std::span<const T>, which point directly into
+/// _bytes, so _bytes must outlive the object. This only works for arrays of
+/// numbers that have been written as typed vectors with elements of type T.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const char* _bytes, const size_t _size) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  return read<T, Ps..., internal::BorrowFromDocument>(_bytes, _size)
+      .transform([](U&& _u) {
+        return Borrowed<U>(Borrowed<U>::no_document(), std::move(_u));
+      });
+}
+
+/// Parses an object from flexbuf using reflection. Unlike read(...), this
+/// supports fields of type std::span<const T>, which point directly into
+/// _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+auto read_borrowed(const std::vector<char>& _bytes) {
+  return read_borrowed<T, Ps...>(_bytes.data(), _bytes.size());
+}
+
 /// Parses an object directly from a stream.
 template <class T, class... Ps>
 auto read(std::istream& _stream) {
@@ -45,6 +71,38 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses a flexbuf var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses flexbuf into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const char* _bytes, const size_t _size) {
+  const InputVarType root =
+      flexbuffers::GetRoot(std::bit_cast<const uint8_t*>(_bytes), _size);
+  return read_into<Ps...>(_obj, root);
+}
+
+/// Parses flexbuf into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_obj, _bytes.data(), _bytes.size());
+}
+
 }  // namespace flexbuf
 }  // namespace rfl
 
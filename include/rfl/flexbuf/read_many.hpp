@@ -0,0 +1,33 @@
+#ifndef RFL_FLEXBUF_READ_MANY_HPP_
+#define RFL_FLEXBUF_READ_MANY_HPP_
+
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../ThreadPool.hpp"
+#include "../internal/read_many.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "read.hpp"
+
+namespace rfl {
+namespace flexbuf {
+
+/// Parses a batch of independent FlexBuffers documents in parallel, using the
+/// threads in _pool. The results are returned in the same order as the
+/// documents.
+template <class T, class... Ps>
+std::vector<Result<internal::wrap_in_rfl_array_t<T>>> read_many(
+    const std::span<const std::string_view> _docs, ThreadPool& _pool) {
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+  const auto read_one = [&](const size_t, const size_t _i) -> ResultType {
+    return read<T, Ps...>(_docs[_i].data(), _docs[_i].size());
+  };
+  return internal::read_many<ResultType>(_docs.size(), _pool, read_one);
+}
+
+}  // namespace flexbuf
+}  // namespace rfl
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef RFL_FROM_GENERIC_HPP_
 #define RFL_FROM_GENERIC_HPP_
 
+#include "CompactGeneric.hpp"
 #include "Generic.hpp"
 #include "generic/read.hpp"
 
@@ -12,6 +13,12 @@ auto from_generic(const Generic& _g) {
   return rfl::generic::read<T, Ps...>(_g);
 }
 
+/// Generates the struct T from a compact generic.
+template <class T, class... Ps>
+auto from_generic(const CompactGeneric& _g) {
+  return rfl::generic::read<T, Ps...>(_g);
+}
+
 }  // namespace rfl
 
 #endif
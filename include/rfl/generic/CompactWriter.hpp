@@ -0,0 +1,116 @@
+#ifndef GENERIC_COMPACTWRITER_HPP_
+#define GENERIC_COMPACTWRITER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../CompactGeneric.hpp"
+#include "../always_false.hpp"
+
+namespace rfl::generic {
+
+/// Writes into an rfl::CompactGeneric. The nodes are added to the arena in
+/// the order in which they are written, so no intermediate rfl::Generic is
+/// needed.
+struct CompactWriter {
+  struct OutputArray {
+    size_t handle_;
+  };
+
+  struct OutputObject {
+    size_t handle_;
+  };
+
+  struct OutputVar {};
+
+  using OutputArrayType = OutputArray;
+  using OutputObjectType = OutputObject;
+  using OutputVarType = OutputVar;
+
+  static constexpr bool supports_string_view_values_ = true;
+
+  CompactWriter() {}
+
+  ~CompactWriter() = default;
+
+  OutputArrayType array_as_root(const size_t _size) const noexcept;
+
+  OutputObjectType object_as_root(const size_t _size) const noexcept;
+
+  OutputVarType null_as_root() const noexcept;
+
+  template <class T>
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    add_value(std::string_view(), _var);
+    return OutputVarType{};
+  }
+
+  OutputArrayType add_array_to_array(const size_t _size,
+                                     OutputArrayType* _parent) const noexcept;
+
+  OutputArrayType add_array_to_object(const std::string_view& _name,
+                                      const size_t _size,
+                                      OutputObjectType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_array(const size_t _size,
+                                       OutputArrayType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name, const size_t _size,
+      OutputObjectType* _parent) const noexcept;
+
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType*) const noexcept {
+    add_value(std::string_view(), _var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const std::string_view& _name,
+                                    const T& _var,
+                                    OutputObjectType*) const noexcept {
+    add_value(_name, _var);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept;
+
+  void end_array(OutputArrayType* _arr) const noexcept;
+
+  void end_object(OutputObjectType* _obj) const noexcept;
+
+  /// Returns the document that has been written. The writer must not be
+  /// used afterwards.
+  CompactGeneric build() const noexcept { return builder_.build(); }
+
+ private:
+  template <class T>
+  void add_value(const std::string_view _name, const T& _var) const noexcept {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      builder_.add_string(_name, _var);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
+      builder_.add_bool(_name, _var);
+    } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
+      builder_.add_double(_name, static_cast<double>(_var));
+    } else if constexpr (std::is_integral<std::remove_cvref_t<T>>()) {
+      builder_.add_int(_name, static_cast<int64_t>(_var));
+    } else {
+      static_assert(always_false_v<T>, "Unsupported type");
+    }
+  }
+
+ private:
+  mutable CompactGeneric::Builder builder_;
+};
+
+}  // namespace rfl::generic
+
+#endif
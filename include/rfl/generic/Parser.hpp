@@ -2,6 +2,8 @@
 #define GENERIC_PARSER_HPP_
 
 #include "../parsing/Parser.hpp"
+#include "CompactReader.hpp"
+#include "CompactWriter.hpp"
 #include "Reader.hpp"
 #include "Writer.hpp"
 
@@ -11,6 +13,10 @@ namespace generic {
 template <class T, class ProcessorsType>
 using Parser = parsing::Parser<Reader, Writer, T, ProcessorsType>;
 
+template <class T, class ProcessorsType>
+using CompactParser =
+    parsing::Parser<CompactReader, CompactWriter, T, ProcessorsType>;
+
 }
 }  // namespace rfl
 
@@ -4,6 +4,7 @@
 #include <istream>
 #include <vector>
 
+#include "../CompactGeneric.hpp"
 #include "../Generic.hpp"
 #include "../Processors.hpp"
 #include "../Result.hpp"
@@ -19,6 +20,14 @@ auto read(const Generic& _g) {
   return Parser<T, Processors<Ps...>>::read(r, _g);
 }
 
+/// Parses an object from a compact generic type.
+template <class T, class... Ps>
+auto read(const CompactGeneric& _g) {
+  const auto r = CompactReader();
+  return CompactParser<T, Processors<Ps...>>::read(
+      r, CompactReader::InputVarType{&_g.get()});
+}
+
 }  // namespace generic
 }  // namespace rfl
 
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <vector>
 
+#include "../CompactGeneric.hpp"
 #include "../Generic.hpp"
 #include "../parsing/Parent.hpp"
 #include "Parser.hpp"
@@ -23,6 +24,17 @@ Generic write(const auto& _t) {
   return w.root();
 }
 
+/// Writes an object to a compact generic.
+template <class... Ps>
+CompactGeneric write_compact(const auto& _t) {
+  using T = std::remove_cvref_t<decltype(_t)>;
+  using ParentType = parsing::Parent<CompactWriter>;
+  auto w = CompactWriter();
+  CompactParser<T, Processors<Ps...>>::write(w, _t,
+                                             typename ParentType::Root{});
+  return w.build();
+}
+
 }  // namespace generic
 }  // namespace rfl
 
@@ -0,0 +1,23 @@
+#ifndef RFL_INTERNAL_BORROWFROMDOCUMENT_HPP_
+#define RFL_INTERNAL_BORROWFROMDOCUMENT_HPP_
+
+namespace rfl {
+namespace internal {
+
+/// This is a "fake" processor, which is added by the read_borrowed(...)
+/// functions. It allows the parsers to read std::string_view and
+/// rfl::BytestringView, pointing into the underlying document. It is not
+/// meant to be passed by the user, because the read_borrowed(...) functions
+/// make sure that the document outlives the object.
+struct BorrowFromDocument {
+ public:
+  template <class StructType>
+  static auto process(auto&& _named_tuple) {
+    return _named_tuple;
+  }
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
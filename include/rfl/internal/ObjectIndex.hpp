@@ -0,0 +1,87 @@
+#ifndef RFL_INTERNAL_OBJECTINDEX_HPP_
+#define RFL_INTERNAL_OBJECTINDEX_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace rfl::internal {
+
+/// A hash index over the keys of a sequence of key-value pairs, such as the
+/// one underlying rfl::Object. The index only stores the positions of the
+/// pairs, so it remains valid when the sequence is reallocated, as long as
+/// no pairs are removed or reordered. If a key occurs several times, the
+/// first occurrence is found.
+class ObjectIndex {
+ public:
+  template <class DataType>
+  explicit ObjectIndex(const DataType& _data) {
+    rehash(_data, std::bit_ceil(2 * _data.size() + 2));
+  }
+
+  ~ObjectIndex() = default;
+
+  /// Must be called after _data.back() has been added to _data.
+  template <class DataType>
+  void add_last(const DataType& _data) {
+    if (2 * _data.size() > slots_.size()) {
+      rehash(_data, 2 * slots_.size());
+    } else {
+      insert(_data, _data.size() - 1);
+    }
+  }
+
+  /// Returns the position of the first pair with the key _key or
+  /// _data.size(), if there is no such pair.
+  template <class DataType>
+  size_t find(const std::string_view _key,
+              const DataType& _data) const noexcept {
+    const auto mask = slots_.size() - 1;
+    for (auto s = hash(_key) & mask; slots_[s] != 0; s = (s + 1) & mask) {
+      const auto i = slots_[s] - 1;
+      if (_data[i].first == _key) {
+        return i;
+      }
+    }
+    return _data.size();
+  }
+
+ private:
+  static size_t hash(const std::string_view _key) noexcept {
+    return std::hash<std::string_view>()(_key);
+  }
+
+  /// Adds the pair at position _i, unless its key is already contained.
+  template <class DataType>
+  void insert(const DataType& _data, const size_t _i) {
+    const auto mask = slots_.size() - 1;
+    const std::string_view key = _data[_i].first;
+    auto s = hash(key) & mask;
+    for (; slots_[s] != 0; s = (s + 1) & mask) {
+      if (_data[slots_[s] - 1].first == key) {
+        return;
+      }
+    }
+    slots_[s] = _i + 1;
+  }
+
+  template <class DataType>
+  void rehash(const DataType& _data, const size_t _num_slots) {
+    slots_.assign(_num_slots, 0);
+    for (size_t i = 0; i < _data.size(); ++i) {
+      insert(_data, i);
+    }
+  }
+
+ private:
+  /// Open addressing with linear probing. Every slot contains the position
+  /// of a pair plus one, 0 marks an empty slot. The number of slots is a
+  /// power of two and at least twice the number of pairs.
+  std::vector<size_t> slots_;
+};
+
+}  // namespace rfl::internal
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef RFL_INTERNAL_STRINGHASHTABLE_HPP_
+#define RFL_INTERNAL_STRINGHASHTABLE_HPP_
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+namespace rfl {
+namespace internal {
+
+/// FNV-1a, which is cheap enough to be computed for every incoming key and
+/// can also be evaluated at compile time.
+constexpr std::uint64_t hash_string(const std::string_view _str) noexcept {
+  std::uint64_t h = 14695981039346656037ull;
+  for (const char c : _str) {
+    h ^= static_cast<std::uint8_t>(c);
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+/// A hash table mapping a fixed set of strings to their index, which is meant
+/// to be built at compile time. The table uses open addressing and has at
+/// least twice as many slots as there are strings, so a lookup usually hits
+/// the right slot immediately and only requires a single string comparison
+/// to confirm the match.
+template <size_t N>
+class StringHashTable {
+  static constexpr size_t num_slots_ = std::bit_ceil(2 * N + 1);
+
+  static constexpr size_t mask_ = num_slots_ - 1;
+
+ public:
+  constexpr StringHashTable(const std::array<std::string_view, N>& _strings)
+      : hashes_{}, slots_{}, strings_(_strings) {
+    slots_.fill(-1);
+    for (size_t i = 0; i < N; ++i) {
+      hashes_[i] = hash_string(strings_[i]);
+      auto s = hashes_[i] & mask_;
+      while (slots_[s] != -1) {
+        s = (s + 1) & mask_;
+      }
+      slots_[s] = static_cast<int>(i);
+    }
+  }
+
+  /// Returns the index of _str or -1, if _str is not part of the table.
+  constexpr int find(const std::string_view _str) const noexcept {
+    const auto h = hash_string(_str);
+    for (auto s = h & mask_; slots_[s] != -1; s = (s + 1) & mask_) {
+      const auto ix = slots_[s];
+      if (hashes_[ix] == h && strings_[ix] == _str) {
+        return ix;
+      }
+    }
+    return -1;
+  }
+
+  /// Returns the string signified by _i.
+  constexpr std::string_view operator[](const size_t _i) const noexcept {
+    return strings_[_i];
+  }
+
+  /// The number of strings in the table.
+  static constexpr size_t size() noexcept { return N; }
+
+ private:
+  /// The hashes of the individual strings.
+  std::array<std::uint64_t, N> hashes_;
+
+  /// The slots of the table, containing the indices of the strings or -1.
+  std::array<int, num_slots_> slots_;
+
+  /// The underlying strings.
+  std::array<std::string_view, N> strings_;
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -3,14 +3,19 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 
 #include "../../Result.hpp"
 #include "../../internal/strings/join.hpp"
-#include "../../internal/strings/split.hpp"
-#include "../../type_name_t.hpp"
+#include "../StringHashTable.hpp"
 #include "get_enum_names.hpp"
 #include "is_flag_enum.hpp"
 
@@ -18,6 +23,9 @@ namespace rfl {
 namespace internal {
 namespace enums {
 
+/// Converts enums to strings and back. All lookups go through tables that
+/// are generated at compile time, so neither direction needs to compare the
+/// input against all of the names or allocate memory.
 template <class EnumType>
 class StringConverter {
  public:
@@ -27,18 +35,138 @@ class StringConverter {
 
   using NamesLiteral = typename decltype(names_)::Literal;
 
+ private:
+  using T = std::underlying_type_t<EnumType>;
+
+  using U = std::make_unsigned_t<T>;
+
+  static constexpr size_t num_bits_ = sizeof(T) * 8;
+
+  static constexpr auto make_name_views() {
+    std::array<std::string_view, names_.size> views{};
+    [&]<int... _is>(std::integer_sequence<int, _is...>) {
+      ((views[_is] = NamesLiteral::template string_view_of<_is>()), ...);
+    }(std::make_integer_sequence<int, static_cast<int>(names_.size)>());
+    return views;
+  }
+
+  /// The names of the enumerators, in the same order as names_.enums_.
+  static constexpr auto name_views_ = make_name_views();
+
+  static constexpr auto name_table_ =
+      StringHashTable<names_.size>(name_views_);
+
+  /// The number of slots in the table mapping values to names. Regular
+  /// enums are indexed by their value, which is between 0 and 127, and flag
+  /// enums are indexed by the position of their bit.
+  static constexpr size_t num_slots() {
+    if constexpr (is_flag_enum_) {
+      return num_bits_;
+    } else {
+      size_t num_slots = 1;
+      for (const auto e : names_.enums_) {
+        num_slots = std::max(num_slots, static_cast<size_t>(e) + 1);
+      }
+      return num_slots;
+    }
+  }
+
+  static constexpr auto make_value_table() {
+    std::array<int, num_slots()> table{};
+    table.fill(-1);
+    for (size_t i = 0; i < names_.size; ++i) {
+      const auto u = static_cast<U>(names_.enums_[i]);
+      if constexpr (is_flag_enum_) {
+        table[std::countr_zero(u)] = static_cast<int>(i);
+      } else {
+        table[u] = static_cast<int>(i);
+      }
+    }
+    return table;
+  }
+
+  /// Maps the values of the enum to the index of their name or -1.
+  static constexpr auto value_table_ = make_value_table();
+
+  /// The number of characters needed to write _val as a number.
+  static constexpr size_t num_chars(const T _val) {
+    size_t n = _val < 0 ? 2 : 1;
+    for (auto v = _val; v / 10 != 0; v /= 10) {
+      ++n;
+    }
+    return n;
+  }
+
+  static constexpr size_t calc_max_flag_size() {
+    if constexpr (is_flag_enum_) {
+      size_t size = 0;
+      for (size_t i = 0; i < num_bits_; ++i) {
+        const auto ix = value_table_[i];
+        size += 1 + (ix != -1 ? name_views_[ix].size()
+                              : num_chars(static_cast<T>(static_cast<U>(1)
+                                                         << i)));
+      }
+      return size;
+    } else {
+      return 0;
+    }
+  }
+
  public:
+  /// The maximum number of characters needed to write a flag enum.
+  static constexpr size_t max_flag_size_ = calc_max_flag_size();
+
   /// Transform an enum to a matching string.
   static std::string enum_to_string(const EnumType _enum) {
     if constexpr (is_flag_enum_) {
-      return flag_enum_to_string(_enum);
+      std::array<char, max_flag_size_> buffer;
+      return std::string(buffer.data(), write_flags(_enum, buffer.data()));
+    } else {
+      const auto view = enum_to_string_view(_enum);
+      if (view) {
+        return std::string(*view);
+      }
+      return std::to_string(static_cast<T>(_enum));
+    }
+  }
+
+  /// Calls _f with the same string enum_to_string(...) would return, but as a
+  /// std::string_view that either points to a name generated at compile
+  /// time or into a buffer on the stack, so nothing is allocated.
+  template <class F>
+  static void with_string_view(const EnumType _enum, const F& _f) {
+    if constexpr (is_flag_enum_) {
+      std::array<char, max_flag_size_> buffer;
+      _f(std::string_view(buffer.data(), write_flags(_enum, buffer.data())));
     } else {
-      return enum_to_single_string(_enum);
+      const auto view = enum_to_string_view(_enum);
+      if (view) {
+        _f(*view);
+        return;
+      }
+      std::array<char, 24> buffer;
+      const auto ptr = std::to_chars(buffer.data(),
+                                     buffer.data() + buffer.size(),
+                                     static_cast<T>(_enum))
+                           .ptr;
+      _f(std::string_view(buffer.data(),
+                          static_cast<size_t>(ptr - buffer.data())));
     }
   }
 
+  /// Returns the name of the enumerator matching _enum or std::nullopt, if
+  /// there is no such enumerator. This does not combine flags.
+  static constexpr std::optional<std::string_view> enum_to_string_view(
+      const EnumType _enum) noexcept {
+    const auto ix = find_name(_enum);
+    if (ix == -1) {
+      return std::nullopt;
+    }
+    return name_views_[ix];
+  }
+
   /// Transforms a string to the matching enum.
-  static Result<EnumType> string_to_enum(const std::string& _str) {
+  static Result<EnumType> string_to_enum(const std::string_view _str) {
     static_assert(names_.size != 0,
                   "No enum could be identified. Please choose enum values "
                   "between 0 to 127 or for flag enums choose 1,2,4,8,16,...");
@@ -49,79 +177,77 @@ class StringConverter {
     }
   }
 
- private:
-  /// Iterates through the enum bit by bit and matches it against the flags.
-  static std::string flag_enum_to_string(const EnumType _e) {
-    using T = std::underlying_type_t<EnumType>;
-    auto val = static_cast<T>(_e);
-    int i = 0;
-    std::vector<std::string> flags;
-    while (val != 0) {
-      const auto bit = val & static_cast<T>(1);
-      if (bit == 1) {
-        auto str = enum_to_single_string(
-            static_cast<EnumType>(static_cast<T>(1) << i));
-        flags.emplace_back(std::move(str));
+  /// Writes a flag enum to _out, which must hold at least max_flag_size_
+  /// characters, and returns the number of characters written. The flags
+  /// are separated by '|' and flags that are not part of the enum are
+  /// written as numbers.
+  static size_t write_flags(const EnumType _enum, char* _out) noexcept {
+    const auto u = static_cast<U>(_enum);
+    auto ptr = _out;
+    for (size_t i = 0; i < num_bits_; ++i) {
+      if (((u >> i) & 1) == 0) {
+        continue;
       }
-      ++i;
-      val >>= 1;
-    }
-    return strings::join("|", flags);
-  }
-
-  /// This assumes that _enum can be exactly matched to one of the names and
-  /// does not have to be combined using |.
-  static std::string enum_to_single_string(const EnumType _enum) {
-    const auto to_str = [](const auto _l) { return _l.str(); };
-
-    for (size_t i = 0; i < names_.size; ++i) {
-      if (names_.enums_[i] == _enum) {
-        return NamesLiteral::from_value(
-                   static_cast<typename NamesLiteral::ValueType>(i))
-            .transform(to_str)
-            .value();
+      if (ptr != _out) {
+        *(ptr++) = '|';
+      }
+      const auto ix = value_table_[i];
+      if (ix != -1) {
+        ptr = std::copy(name_views_[ix].begin(), name_views_[ix].end(), ptr);
+      } else {
+        const auto val = static_cast<T>(static_cast<U>(1) << i);
+        ptr = std::to_chars(ptr, _out + max_flag_size_, val).ptr;
       }
     }
-
-    return std::to_string(static_cast<std::underlying_type_t<EnumType>>(_enum));
+    return static_cast<size_t>(ptr - _out);
   }
 
-  /// Finds the enum matching the literal.
-  static EnumType literal_to_enum(const NamesLiteral _lit) noexcept {
-    return names_.enums_[_lit.value()];
+ private:
+  /// Returns the index of the name matching _enum exactly or -1.
+  static constexpr int find_name(const EnumType _enum) noexcept {
+    const auto u = static_cast<U>(_enum);
+    if constexpr (is_flag_enum_) {
+      return std::has_single_bit(u) ? value_table_[std::countr_zero(u)] : -1;
+    } else {
+      return u < value_table_.size() ? value_table_[u] : -1;
+    }
   }
 
-  /// This assumes that _enum can be exactly matched to one of the names and
+  /// This assumes that _str can be exactly matched to one of the names and
   /// does not have to be combined using |.
-  static Result<EnumType> single_string_to_enum(const std::string& _str) {
-    const auto r = NamesLiteral::from_string(_str).transform(literal_to_enum);
-    if (r) {
-      return r;
-    } else {
-      try {
-        return static_cast<EnumType>(std::stoi(_str));
-      } catch (std::exception& exp) {
-        return Error(exp.what());
-      }
+  static Result<EnumType> single_string_to_enum(const std::string_view _str) {
+    const auto ix = name_table_.find(_str);
+    if (ix != -1) {
+      return names_.enums_[ix];
     }
+    T val = 0;
+    const auto [ptr, ec] =
+        std::from_chars(_str.data(), _str.data() + _str.size(), val);
+    if (ec == std::errc() && ptr == _str.data() + _str.size()) {
+      return static_cast<EnumType>(val);
+    }
+    return Error("Could not convert '" + std::string(_str) +
+                 "' to an enum. The following values are allowed: " +
+                 strings::join(", ", NamesLiteral::names()) + ".");
   }
 
   /// Only relevant if this is a flag enum - combines the different matches
   /// using |.
-  static Result<EnumType> string_to_flag_enum(
-      const std::string& _str) noexcept {
-    using T = std::underlying_type_t<EnumType>;
-    const auto split = strings::split(_str, "|");
+  static Result<EnumType> string_to_flag_enum(const std::string_view _str) {
     auto res = static_cast<T>(0);
-    for (const auto& s : split) {
-      const auto r = single_string_to_enum(s);
-      if (r) {
-        res |= static_cast<T>(*r);
-      } else {
+    size_t begin = 0;
+    while (true) {
+      const auto end = _str.find('|', begin);
+      const auto r = single_string_to_enum(_str.substr(begin, end - begin));
+      if (!r) {
         return r;
       }
+      res |= static_cast<T>(*r);
+      if (end == std::string_view::npos) {
+        return static_cast<EnumType>(res);
+      }
+      begin = end + 1;
     }
-    return static_cast<EnumType>(res);
   }
 };
 
@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISASSUMEORDEREDFIELDS_HPP_
+#define RFL_INTERNAL_ISASSUMEORDEREDFIELDS_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../AssumeOrderedFields.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_assume_ordered_fields;
+
+template <class T>
+class is_assume_ordered_fields : public std::false_type {};
+
+template <>
+class is_assume_ordered_fields<AssumeOrderedFields> : public std::true_type {};
+
+template <class T>
+constexpr bool is_assume_ordered_fields_v = is_assume_ordered_fields<
+    std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISBORROWFROMDOCUMENT_HPP_
+#define RFL_INTERNAL_ISBORROWFROMDOCUMENT_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "BorrowFromDocument.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_borrow_from_document;
+
+template <class T>
+class is_borrow_from_document : public std::false_type {};
+
+template <>
+class is_borrow_from_document<BorrowFromDocument> : public std::true_type {};
+
+template <class T>
+constexpr bool is_borrow_from_document_v = is_borrow_from_document<
+    std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_ISFAILFAST_HPP_
+#define RFL_INTERNAL_ISFAILFAST_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../FailFast.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+class is_fail_fast;
+
+template <class T>
+class is_fail_fast : public std::false_type {};
+
+template <>
+class is_fail_fast<FailFast> : public std::true_type {};
+
+template <class T>
+constexpr bool is_fail_fast_v =
+    is_fail_fast<std::remove_cvref_t<std::remove_pointer_t<T>>>::value;
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef RFL_INTERNAL_READ_MANY_HPP_
+#define RFL_INTERNAL_READ_MANY_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../ThreadPool.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// Calls _read(_worker, _i) for every _i in [0, _n) on the thread pool and
+/// returns the results in order.
+template <class ResultType, class ReadFunction>
+std::vector<ResultType> read_many(const size_t _n, ThreadPool& _pool,
+                                  const ReadFunction& _read) {
+  // Optionals do not require ResultType to be copyable and do not build an
+  // error message for every document up front.
+  auto slots = std::vector<std::optional<ResultType>>(_n);
+  _pool.for_each(_n, [&](const size_t _worker, const size_t _i) {
+    slots[_i].emplace(_read(_worker, _i));
+  });
+  auto results = std::vector<ResultType>();
+  results.reserve(_n);
+  for (auto& slot : slots) {
+    if (slot) {
+      results.emplace_back(std::move(*slot));
+    } else {
+      results.emplace_back(Error("Document was not read."));
+    }
+  }
+  return results;
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
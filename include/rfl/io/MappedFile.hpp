@@ -0,0 +1,79 @@
+#ifndef RFL_IO_MAPPEDFILE_HPP_
+#define RFL_IO_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../Result.hpp"
+
+namespace rfl {
+namespace io {
+
+/// A read-only view of a file that is mapped into memory. This allows us to
+/// parse the file straight from the page cache, without reading it into a
+/// buffer first. Pipes and other files that are not regular files cannot be
+/// mapped, so they are read into a buffer instead.
+class MappedFile {
+ public:
+  MappedFile(const MappedFile& _other) = delete;
+
+  MappedFile(MappedFile&& _other) noexcept;
+
+  ~MappedFile();
+
+  /// Maps the file signified by _fname into memory or reads it, if it is not
+  /// a regular file.
+  static Result<MappedFile> open(const std::string& _fname) noexcept;
+
+  /// The content of the file. Note that it is not null-terminated.
+  const char* data() const noexcept {
+    return is_mapped_ ? data_ : buffer_.data();
+  }
+
+  /// The size of the file in bytes.
+  size_t size() const noexcept {
+    return is_mapped_ ? size_ : buffer_.size();
+  }
+
+  /// The content of the file as a string_view.
+  std::string_view view() const noexcept {
+    return std::string_view(data(), size());
+  }
+
+  MappedFile& operator=(const MappedFile& _other) = delete;
+
+  MappedFile& operator=(MappedFile&& _other) noexcept;
+
+ private:
+  MappedFile(const char* _data, const size_t _size)
+      : data_(_data), size_(_size), is_mapped_(true) {}
+
+  explicit MappedFile(std::string&& _buffer)
+      : buffer_(std::move(_buffer)),
+        data_(nullptr),
+        size_(0),
+        is_mapped_(false) {}
+
+  void unmap() noexcept;
+
+ private:
+  /// The content of files that could not be mapped.
+  std::string buffer_;
+
+  /// The beginning of the mapped memory.
+  const char* data_;
+
+  /// The size of the mapped memory.
+  size_t size_;
+
+  /// Empty files and files that are not regular files cannot be mapped, in
+  /// which case this is false and the content is in buffer_.
+  bool is_mapped_;
+};
+
+}  // namespace io
+}  // namespace rfl
+
+#endif
@@ -14,8 +14,21 @@ namespace io {
 inline Result<std::vector<char>> load_bytes(const std::string& _fname) {
   std::ifstream input(_fname, std::ios::binary);
   if (input.is_open()) {
-    std::istreambuf_iterator<char> begin(input), end;
-    const auto bytes = std::vector<char>(begin, end);
+    // Reading the file in one go is much faster than iterating over it, but
+    // only possible if its size is known. Pipes and other special files
+    // cannot be seeked, so we fall back to iterating over them.
+    const auto size = input.seekg(0, std::ios::end).tellg();
+    if (size < 0) {
+      input.clear();
+      std::istreambuf_iterator<char> begin(input), end;
+      auto bytes = std::vector<char>(begin, end);
+      input.close();
+      return bytes;
+    }
+    auto bytes = std::vector<char>(static_cast<size_t>(size));
+    input.seekg(0);
+    input.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    bytes.resize(static_cast<size_t>(input.gcount()));
     input.close();
     return bytes;
   } else {
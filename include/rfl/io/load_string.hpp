@@ -11,10 +11,23 @@ namespace rfl {
 namespace io {
 
 inline Result<std::string> load_string(const std::string& _fname) {
-  std::ifstream infile(_fname);
+  std::ifstream infile(_fname, std::ios::binary);
   if (infile.is_open()) {
-    auto r = std::string(std::istreambuf_iterator<char>(infile),
-                         std::istreambuf_iterator<char>());
+    // Reading the file in one go is much faster than iterating over it, but
+    // only possible if its size is known. Pipes and other special files
+    // cannot be seeked, so we fall back to iterating over them.
+    const auto size = infile.seekg(0, std::ios::end).tellg();
+    if (size < 0) {
+      infile.clear();
+      auto r = std::string(std::istreambuf_iterator<char>(infile),
+                           std::istreambuf_iterator<char>());
+      infile.close();
+      return r;
+    }
+    auto r = std::string(static_cast<size_t>(size), '\0');
+    infile.seekg(0);
+    infile.read(r.data(), static_cast<std::streamsize>(r.size()));
+    r.resize(static_cast<size_t>(infile.gcount()));
     infile.close();
     return r;
   } else {
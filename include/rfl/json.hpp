@@ -2,13 +2,20 @@
 #define RFL_JSON_HPP_
 
 #include "../rfl.hpp"
+#include "json/Context.hpp"
+#include "json/DirectWriter.hpp"
+#include "json/Lines.hpp"
 #include "json/Parser.hpp"
+#include "json/ReadOptions.hpp"
 #include "json/Reader.hpp"
 #include "json/Writer.hpp"
 #include "json/load.hpp"
 #include "json/read.hpp"
+#include "json/read_lines.hpp"
+#include "json/read_many.hpp"
 #include "json/save.hpp"
 #include "json/to_schema.hpp"
 #include "json/write.hpp"
+#include "json/write_lines.hpp"
 
 #endif
@@ -0,0 +1,88 @@
+#ifndef RFL_JSON_CONTEXT_HPP_
+#define RFL_JSON_CONTEXT_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace rfl {
+namespace json {
+
+/// A growable arena that can be passed to read(...) and write(...), so that
+/// the memory used for the yyjson documents is reused across calls instead of
+/// being allocated and freed for every message. The arena is reset at the
+/// beginning of every call, which is why anything that was read or written
+/// never points into it. Once the arena has grown to the size of the largest
+/// message, no further allocations are necessary.
+///
+/// A context must not be shared between threads - the intended usage is to
+/// keep one context per thread.
+class Context {
+ public:
+  explicit Context(const size_t _initial_size = 64 * 1024);
+
+  Context(const Context& _other) = delete;
+
+  Context(Context&& _other) = delete;
+
+  ~Context() = default;
+
+  /// The allocator to be passed to yyjson.
+  const yyjson_alc* allocator() const noexcept { return &alc_; }
+
+  /// The total amount of memory currently held by the arena.
+  size_t capacity() const noexcept;
+
+  /// Marks all of the memory as unused. If the arena has been spread over
+  /// several blocks, they are merged into a single one, so that the next
+  /// message of the same size can be handled without any allocations.
+  void reset() noexcept;
+
+  Context& operator=(const Context& _other) = delete;
+
+  Context& operator=(Context&& _other) = delete;
+
+ private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data_;
+    size_t size_;
+  };
+
+  void* allocate(const size_t _size) noexcept;
+
+  void* reallocate(void* _ptr, const size_t _old_size,
+                   const size_t _size) noexcept;
+
+  bool add_block(const size_t _min_size) noexcept;
+
+  static void* yyjson_malloc(void* _ctx, size_t _size);
+
+  static void* yyjson_realloc(void* _ctx, void* _ptr, size_t _old_size,
+                              size_t _size);
+
+  static void yyjson_free(void* _ctx, void* _ptr);
+
+ private:
+  /// The blocks of memory, the last of which is the one currently in use.
+  std::vector<Block> blocks_;
+
+  /// The position of the next allocation within the last block.
+  size_t pos_;
+
+  /// The most recent allocation, which can be grown in place.
+  std::byte* last_;
+
+  /// The allocator to be passed to yyjson, pointing to this context.
+  yyjson_alc alc_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef RFL_JSON_DIRECTWRITER_HPP_
+#define RFL_JSON_DIRECTWRITER_HPP_
+
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../always_false.hpp"
+#include "../parsing/KeyToken.hpp"
+
+namespace rfl {
+namespace json {
+
+/// A writer that produces the JSON text directly while the parser walks
+/// the object, instead of building a yyjson document first and serializing
+/// it afterwards. The output is identical to the output of json::Writer.
+/// The text is appended to a buffer which, if a stream is passed, is
+/// regularly flushed into the stream.
+class DirectWriter {
+ public:
+  struct DirectOutputArray {
+    size_t depth_;
+    bool empty_;
+  };
+
+  struct DirectOutputObject {
+    size_t depth_;
+    bool empty_;
+  };
+
+  struct DirectOutputVar {};
+
+  using OutputArrayType = DirectOutputArray;
+  using OutputObjectType = DirectOutputObject;
+  using OutputVarType = DirectOutputVar;
+
+  static constexpr bool supports_string_view_values_ = true;
+
+  DirectWriter(std::string* _buffer, std::ostream* _stream = nullptr,
+               const bool _pretty = false);
+
+  /// Encodes a key as a quoted and escaped JSON string, followed by the
+  /// colon. When pretty-printing, the space after the colon is added
+  /// separately.
+  static constexpr size_t encode_key(const std::string_view _name,
+                                     char* _out) noexcept {
+    constexpr std::string_view hex = "0123456789ABCDEF";
+    size_t size = 0;
+    const auto put = [&](const char _c) {
+      if (_out) {
+        _out[size] = _c;
+      }
+      ++size;
+    };
+    put('"');
+    for (const char c : _name) {
+      const auto u = static_cast<unsigned char>(c);
+      if (u >= 0x20 && c != '"' && c != '\\') {
+        put(c);
+        continue;
+      }
+      put('\\');
+      switch (c) {
+        case '"':
+        case '\\':
+          put(c);
+          break;
+        case '\b':
+          put('b');
+          break;
+        case '\f':
+          put('f');
+          break;
+        case '\n':
+          put('n');
+          break;
+        case '\r':
+          put('r');
+          break;
+        case '\t':
+          put('t');
+          break;
+        default:
+          put('u');
+          put('0');
+          put('0');
+          put(hex[u >> 4]);
+          put(hex[u & 0xF]);
+          break;
+      }
+    }
+    put('"');
+    put(':');
+    return size;
+  }
+
+  OutputArrayType array_as_root(const size_t) const noexcept;
+
+  OutputObjectType object_as_root(const size_t) const noexcept;
+
+  OutputVarType null_as_root() const noexcept;
+
+  template <class T>
+  OutputVarType value_as_root(const T& _var) const noexcept {
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  OutputArrayType add_array_to_array(const size_t,
+                                     OutputArrayType* _parent) const noexcept;
+
+  OutputArrayType add_array_to_object(const std::string_view& _name,
+                                      const size_t,
+                                      OutputObjectType* _parent) const noexcept;
+
+  OutputArrayType add_array_to_object(const parsing::KeyToken& _key,
+                                      const size_t,
+                                      OutputObjectType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_array(const size_t,
+                                       OutputArrayType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_object(
+      const std::string_view& _name, const size_t,
+      OutputObjectType* _parent) const noexcept;
+
+  OutputObjectType add_object_to_object(
+      const parsing::KeyToken& _key, const size_t,
+      OutputObjectType* _parent) const noexcept;
+
+  template <class T>
+  OutputVarType add_value_to_array(const T& _var,
+                                   OutputArrayType* _parent) const noexcept {
+    new_element(&_parent->empty_, _parent->depth_);
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const std::string_view& _name,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    new_element(&_parent->empty_, _parent->depth_);
+    write_key(_name);
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  template <class T>
+  OutputVarType add_value_to_object(const parsing::KeyToken& _key,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    new_element(&_parent->empty_, _parent->depth_);
+    write_key(_key);
+    write_basic_type(_var);
+    return OutputVarType{};
+  }
+
+  OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
+
+  OutputVarType add_null_to_object(const std::string_view& _name,
+                                   OutputObjectType* _parent) const noexcept;
+
+  OutputVarType add_null_to_object(const parsing::KeyToken& _key,
+                                   OutputObjectType* _parent) const noexcept;
+
+  void end_array(OutputArrayType* _arr) const noexcept;
+
+  void end_object(OutputObjectType* _obj) const noexcept;
+
+  /// Writes whatever is left in the buffer into the stream, if there is one.
+  void flush() const;
+
+ private:
+  /// Adds the separator and, if we are pretty-printing, the indentation that
+  /// need to precede a new element in a container.
+  void new_element(bool* _empty, const size_t _depth) const noexcept;
+
+  /// Closes a container.
+  void close(const char _c, const bool _empty,
+             const size_t _depth) const noexcept;
+
+  /// Starts a new line with the indentation signified by _depth.
+  void indent(const size_t _depth) const noexcept;
+
+  /// Flushes the buffer, if it has grown beyond a certain size.
+  void maybe_flush() const noexcept;
+
+  void write_double(const double _d) const noexcept;
+
+  void write_key(const std::string_view _name) const noexcept;
+
+  void write_key(const parsing::KeyToken& _key) const noexcept {
+    buffer_->append(_key.encoded_);
+    if (pretty_) {
+      buffer_->push_back(' ');
+    }
+  }
+
+  void write_string(const std::string_view _str) const noexcept;
+
+  template <class T>
+  void write_integer(const T _i) const noexcept {
+    char buf[24];
+    const auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), _i);
+    buffer_->append(buf, ptr);
+  }
+
+  template <class T>
+  void write_basic_type(const T& _var) const noexcept {
+    if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>() ||
+                  std::is_same<std::remove_cvref_t<T>, std::string_view>()) {
+      write_string(_var);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
+      buffer_->append(_var ? "true" : "false");
+    } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
+      write_double(static_cast<double>(_var));
+    } else if constexpr (std::is_unsigned<std::remove_cvref_t<T>>()) {
+      write_integer(static_cast<uint64_t>(_var));
+    } else if constexpr (std::is_integral<std::remove_cvref_t<T>>()) {
+      write_integer(static_cast<int64_t>(_var));
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+  }
+
+ private:
+  /// The buffer the text is written into.
+  std::string* buffer_;
+
+  /// The stream the buffer is flushed into, if any.
+  std::ostream* stream_;
+
+  /// Whether the output is supposed to be pretty-printed.
+  bool pretty_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef RFL_JSON_LINES_HPP_
+#define RFL_JSON_LINES_HPP_
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../Result.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "Context.hpp"
+#include "read.hpp"
+
+namespace rfl {
+namespace json {
+
+/// A lazy range over the objects in newline-delimited JSON (also known as
+/// NDJSON or JSON Lines). Every line is parsed only when the iterator
+/// reaches it. The line buffer and the parser context are reused for all
+/// lines, so the memory consumption does not depend on the number of lines.
+/// Empty lines are skipped.
+///
+/// This is a single-pass input range: Once the iterator has moved on, the
+/// previous lines are gone.
+template <class T, class... Ps>
+class Lines {
+ public:
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+
+  class Iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = ResultType;
+
+    Iterator() : lines_(nullptr) {}
+
+    explicit Iterator(Lines* _lines) : lines_(_lines) {}
+
+    ResultType& operator*() const { return *lines_->current_; }
+
+    ResultType* operator->() const { return &*lines_->current_; }
+
+    Iterator& operator++() {
+      lines_->next();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const {
+      return !lines_ || !lines_->current_;
+    }
+
+   private:
+    /// The range this iterator belongs to.
+    Lines* lines_;
+  };
+
+  /// Reads from a stream that is owned by someone else and must outlive the
+  /// range.
+  explicit Lines(std::istream* _stream)
+      : ctx_(std::make_unique<Context>()),
+        line_num_(0),
+        started_(false),
+        stream_(_stream) {}
+
+  /// Reads from a stream that is owned by the range.
+  explicit Lines(std::unique_ptr<std::istream>&& _stream)
+      : ctx_(std::make_unique<Context>()),
+        line_num_(0),
+        owned_stream_(std::move(_stream)),
+        started_(false),
+        stream_(owned_stream_.get()) {}
+
+  Lines(const Lines& _other) = delete;
+
+  Lines(Lines&& _other) noexcept = default;
+
+  ~Lines() = default;
+
+  /// Parses the first line. Since this is a single-pass range, begin() can
+  /// only be called once in any meaningful way.
+  Iterator begin() {
+    if (!started_) {
+      started_ = true;
+      next();
+    }
+    return Iterator(this);
+  }
+
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+  Lines& operator=(const Lines& _other) = delete;
+
+  Lines& operator=(Lines&& _other) noexcept = default;
+
+ private:
+  /// Parses the next non-empty line or resets current_, if there is none.
+  void next() {
+    while (std::getline(*stream_, line_)) {
+      ++line_num_;
+      if (!line_.empty() && line_.back() == '\r') {
+        line_.pop_back();
+      }
+      if (line_.find_first_not_of(" \t") == std::string::npos) {
+        continue;
+      }
+      current_.emplace(read<T, Ps...>(line_, *ctx_).or_else([&](auto _err) {
+        return ResultType(Error("Line " + std::to_string(line_num_) + ": " +
+                                _err.what()));
+      }));
+      return;
+    }
+    current_.reset();
+  }
+
+ private:
+  /// The context used for parsing, which is reused for every line. It is
+  /// kept on the heap, because contexts cannot be moved.
+  std::unique_ptr<Context> ctx_;
+
+  /// The result of parsing the current line.
+  std::optional<ResultType> current_;
+
+  /// The buffer for the current line, which is reused for every line.
+  std::string line_;
+
+  /// The number of the current line, counting from 1.
+  size_t line_num_;
+
+  /// The stream, if it is owned by the range.
+  std::unique_ptr<std::istream> owned_stream_;
+
+  /// Whether begin() has already been called.
+  bool started_;
+
+  /// The stream we are reading from.
+  std::istream* stream_;
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef RFL_JSON_READOPTIONS_HPP_
+#define RFL_JSON_READOPTIONS_HPP_
+
+#if __has_include(<yyjson.h>)
+#include <yyjson.h>
+#else
+#include "../thirdparty/yyjson.h"
+#endif
+
+namespace rfl {
+namespace json {
+
+/// Options for parsing JSON that is not strictly standard-conforming. They
+/// correspond to the read flags of yyjson. All of them are disabled by
+/// default.
+struct ReadOptions {
+  /// Allows C-style single line and multi-line comments.
+  bool allow_comments = false;
+
+  /// Allows a trailing comma at the end of an object or array.
+  bool allow_trailing_commas = false;
+
+  /// Allows nan, inf and infinity (case-insensitive) as numbers.
+  bool allow_inf_and_nan = false;
+
+  /// Allows strings that are not valid UTF-8.
+  bool allow_invalid_unicode = false;
+
+  /// Keeps numbers that cannot be represented as a 64-bit integer or a
+  /// double without losing precision as raw strings. They can then be read
+  /// into fields of type std::string.
+  bool bignum_as_raw = false;
+
+  /// Translates the options into the yyjson read flags.
+  constexpr yyjson_read_flag flags() const noexcept {
+    yyjson_read_flag flg = YYJSON_READ_NOFLAG;
+    if (allow_comments) {
+      flg |= YYJSON_READ_ALLOW_COMMENTS;
+    }
+    if (allow_trailing_commas) {
+      flg |= YYJSON_READ_ALLOW_TRAILING_COMMAS;
+    }
+    if (allow_inf_and_nan) {
+      flg |= YYJSON_READ_ALLOW_INF_AND_NAN;
+    }
+    if (allow_invalid_unicode) {
+      flg |= YYJSON_READ_ALLOW_INVALID_UNICODE;
+    }
+    if (bignum_as_raw) {
+      flg |= YYJSON_READ_BIGNUM_AS_RAW;
+    }
+    return flg;
+  }
+};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -8,16 +8,20 @@
 #endif
 
 #include <array>
+#include <charconv>
 #include <concepts>
 #include <exception>
 #include <map>
 #include <memory>
+#include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../Result.hpp"
@@ -47,6 +51,8 @@ struct Reader {
   using InputObjectType = YYJSONInputObject;
   using InputVarType = YYJSONInputVar;
 
+  static constexpr bool supports_string_views_ = true;
+
   template <class T>
   static constexpr bool has_custom_constructor =
       (requires(InputVarType var) { T::from_json_obj(var); });
@@ -57,8 +63,43 @@ struct Reader {
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType _obj) const noexcept;
 
+  std::optional<std::pair<std::string_view, InputVarType>> get_first_field(
+      const InputObjectType _obj) const noexcept;
+
   bool is_empty(const InputVarType _var) const noexcept;
 
+  size_t size_hint(const InputArrayType _arr) const noexcept;
+
+  size_t size_hint(const InputObjectType _obj) const noexcept;
+
+  template <class T>
+  size_t read_numbers(const InputArrayType _arr,
+                      const std::span<T> _out) const noexcept {
+    yyjson_arr_iter iter;
+    yyjson_arr_iter_init(_arr.val_, &iter);
+    size_t i = 0;
+    for (; i < _out.size(); ++i) {
+      yyjson_val* val = yyjson_arr_iter_next(&iter);
+      if constexpr (std::is_floating_point<T>()) {
+        if (!yyjson_is_num(val)) {
+          break;
+        }
+        _out[i] = static_cast<T>(yyjson_get_num(val));
+      } else if constexpr (std::is_unsigned<T>()) {
+        if (!yyjson_is_int(val)) {
+          break;
+        }
+        _out[i] = static_cast<T>(yyjson_get_uint(val));
+      } else {
+        if (!yyjson_is_int(val)) {
+          break;
+        }
+        _out[i] = static_cast<T>(yyjson_get_sint(val));
+      }
+    }
+    return i;
+  }
+
   template <class ArrayReader>
   std::optional<Error> read_array(const ArrayReader& _array_reader,
                                   const InputArrayType& _arr) const noexcept {
@@ -90,17 +131,37 @@ struct Reader {
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
-      const auto r = yyjson_get_str(_var.val_);
+      // Raw numbers only occur when ReadOptions::bignum_as_raw is set.
+      const auto r = yyjson_is_raw(_var.val_) ? yyjson_get_raw(_var.val_)
+                                              : yyjson_get_str(_var.val_);
       if (r == NULL) {
         return rfl::Error("Could not cast to string.");
       }
-      return std::string(r);
+      return std::string(r, yyjson_get_len(_var.val_));
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      const auto r = yyjson_is_raw(_var.val_) ? yyjson_get_raw(_var.val_)
+                                              : yyjson_get_str(_var.val_);
+      if (r == NULL) {
+        return rfl::Error("Could not cast to string.");
+      }
+      return std::string_view(r, yyjson_get_len(_var.val_));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       if (!yyjson_is_bool(_var.val_)) {
         return rfl::Error("Could not cast to boolean.");
       }
       return yyjson_get_bool(_var.val_);
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
+      if (yyjson_is_raw(_var.val_)) {
+        const auto str = yyjson_get_raw(_var.val_);
+        const auto end = str + yyjson_get_len(_var.val_);
+        std::remove_cvref_t<T> value = 0;
+        const auto [ptr, ec] = std::from_chars(str, end, value);
+        if (ec != std::errc() || ptr != end) {
+          return rfl::Error("Could not cast to double.");
+        }
+        return value;
+      }
       if (!yyjson_is_num(_var.val_)) {
         return rfl::Error("Could not cast to double.");
       }
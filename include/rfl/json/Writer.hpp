@@ -18,6 +18,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "../parsing/KeyToken.hpp"
 
 namespace rfl {
 namespace json {
@@ -48,8 +49,23 @@ class Writer {
   using OutputObjectType = YYJSONOutputObject;
   using OutputVarType = YYJSONOutputVar;
 
+  static constexpr bool supports_string_view_values_ = true;
+
   Writer(yyjson_mut_doc* _doc);
 
+  /// yyjson escapes the keys when serializing the document, so the key
+  /// token is just the name. But because the token has static storage
+  /// duration, it does not need to be copied into the document.
+  static constexpr size_t encode_key(const std::string_view _name,
+                                     char* _out) noexcept {
+    if (_out) {
+      for (size_t i = 0; i < _name.size(); ++i) {
+        _out[i] = _name[i];
+      }
+    }
+    return _name.size();
+  }
+
   OutputArrayType array_as_root(const size_t) const noexcept;
 
   OutputObjectType object_as_root(const size_t) const noexcept;
@@ -70,6 +86,10 @@ class Writer {
                                       const size_t,
                                       OutputObjectType* _parent) const noexcept;
 
+  OutputArrayType add_array_to_object(const parsing::KeyToken& _key,
+                                      const size_t,
+                                      OutputObjectType* _parent) const noexcept;
+
   OutputObjectType add_object_to_array(const size_t,
                                        OutputArrayType* _parent) const noexcept;
 
@@ -77,6 +97,10 @@ class Writer {
       const std::string_view& _name, const size_t,
       OutputObjectType* _parent) const noexcept;
 
+  OutputObjectType add_object_to_object(
+      const parsing::KeyToken& _key, const size_t,
+      OutputObjectType* _parent) const noexcept;
+
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
@@ -95,20 +119,39 @@ class Writer {
     return OutputVarType(val);
   }
 
+  template <class T>
+  OutputVarType add_value_to_object(const parsing::KeyToken& _key,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    const auto val = from_basic_type(_var);
+    yyjson_mut_obj_add(_parent->val_, key_to_yyjson(_key), val.val_);
+    return OutputVarType(val);
+  }
+
   OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
 
   OutputVarType add_null_to_object(const std::string_view& _name,
                                    OutputObjectType* _parent) const noexcept;
 
+  OutputVarType add_null_to_object(const parsing::KeyToken& _key,
+                                   OutputObjectType* _parent) const noexcept;
+
   void end_array(OutputArrayType*) const noexcept;
 
   void end_object(OutputObjectType*) const noexcept;
 
  private:
+  yyjson_mut_val* key_to_yyjson(const parsing::KeyToken& _key) const noexcept {
+    return yyjson_mut_strn(doc_, _key.encoded_.data(), _key.encoded_.size());
+  }
+
   template <class T>
   OutputVarType from_basic_type(const T& _var) const noexcept {
     if constexpr (std::is_same<std::remove_cvref_t<T>, std::string>()) {
       return OutputVarType(yyjson_mut_strcpy(doc_, _var.c_str()));
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      return OutputVarType(yyjson_mut_strncpy(doc_, _var.data(), _var.size()));
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       return OutputVarType(yyjson_mut_bool(doc_, _var));
     } else if constexpr (std::is_floating_point<std::remove_cvref_t<T>>()) {
@@ -2,7 +2,7 @@
 #define RFL_JSON_LOAD_HPP_
 
 #include "../Result.hpp"
-#include "../io/load_string.hpp"
+#include "../io/MappedFile.hpp"
 #include "read.hpp"
 
 namespace rfl {
@@ -10,10 +10,10 @@ namespace json {
 
 template <class T, class... Ps>
 Result<T> load(const std::string& _fname) {
-  const auto read_string = [](const auto& _str) {
-    return read<T, Ps...>(_str);
+  const auto read_file = [](const auto& _file) {
+    return read<T, Ps...>(_file.view());
   };
-  return rfl::io::load_string(_fname).and_then(read_string);
+  return rfl::io::MappedFile::open(_fname).and_then(read_file);
 }
 
 }  // namespace json
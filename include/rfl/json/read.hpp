@@ -7,13 +7,22 @@
 #include "../thirdparty/yyjson.h"
 #endif
 
+#include <algorithm>
 #include <istream>
+#include <span>
 #include <string>
+#include <string_view>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/BorrowFromDocument.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
+#include "Context.hpp"
 #include "Parser.hpp"
+#include "ReadOptions.hpp"
 #include "Reader.hpp"
+#include "Writer.hpp"
 
 namespace rfl {
 namespace json {
@@ -28,10 +37,65 @@ auto read(const InputVarType& _obj) {
   return Parser<T, Processors<Ps...>>::read(r, _obj);
 }
 
+/// The number of bytes read_insitu(...) requires at the end of the buffer.
+inline constexpr size_t insitu_padding = YYJSON_PADDING_SIZE;
+
 /// Parses an object from JSON using reflection.
 template <class T, class... Ps>
-Result<internal::wrap_in_rfl_array_t<T>> read(const std::string& _json_str) {
-  yyjson_doc* doc = yyjson_read(_json_str.c_str(), _json_str.size(), 0);
+Result<internal::wrap_in_rfl_array_t<T>> read(
+    const std::string_view _json_str,
+    const ReadOptions& _options = ReadOptions()) {
+  yyjson_doc* doc =
+      yyjson_read(_json_str.data(), _json_str.size(), _options.flags());
+  if (!doc) {
+    return Error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  const auto r = Reader();
+  auto res = Parser<T, Processors<Ps...>>::read(r, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
+/// Parses an object from JSON using reflection. The memory required for
+/// parsing is taken from _ctx, which is reset before parsing.
+template <class T, class... Ps>
+Result<internal::wrap_in_rfl_array_t<T>> read(
+    const std::string_view _json_str, Context& _ctx,
+    const ReadOptions& _options = ReadOptions()) {
+  _ctx.reset();
+  // yyjson only modifies the input when YYJSON_READ_INSITU is passed.
+  yyjson_doc* doc =
+      yyjson_read_opts(const_cast<char*>(_json_str.data()), _json_str.size(),
+                       _options.flags(), _ctx.allocator(), NULL);
+  if (!doc) {
+    return Error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  const auto r = Reader();
+  auto res = Parser<T, Processors<Ps...>>::read(r, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
+/// Parses an object from JSON using reflection, without copying the input
+/// first. Instead, the document is parsed in place, which means that the
+/// content of _buffer is overwritten. _buffer must contain the JSON string,
+/// followed by insitu_padding additional bytes.
+template <class T, class... Ps>
+Result<internal::wrap_in_rfl_array_t<T>> read_insitu(
+    const std::span<char> _buffer,
+    const ReadOptions& _options = ReadOptions()) {
+  if (_buffer.size() < insitu_padding) {
+    return Error(
+        "The buffer must end with at least rfl::json::insitu_padding bytes "
+        "of padding.");
+  }
+  const auto size = _buffer.size() - insitu_padding;
+  std::fill(_buffer.begin() + size, _buffer.end(), '\0');
+  yyjson_doc* doc =
+      yyjson_read_opts(_buffer.data(), size,
+                       _options.flags() | YYJSON_READ_INSITU, NULL, NULL);
   if (!doc) {
     return Error("Could not parse document");
   }
@@ -50,6 +114,84 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(json_str);
 }
 
+/// Parses an object from JSON using reflection. Unlike read(...), this
+/// supports fields of type std::string_view, which point directly into the
+/// parsed document. The document is owned by the returned object.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const std::string_view _json_str) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  yyjson_doc* doc = yyjson_read(_json_str.data(), _json_str.size(), 0);
+  if (!doc) {
+    return Error("Could not parse document");
+  }
+  auto handle = typename Borrowed<U>::DocumentType(doc, [](void* _ptr) {
+    yyjson_doc_free(static_cast<yyjson_doc*>(_ptr));
+  });
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  const auto r = Reader();
+  return Parser<T, Processors<Ps..., internal::BorrowFromDocument>>::read(
+             r, InputVarType(root))
+      .transform([&](U&& _u) {
+        return Borrowed<U>(std::move(handle), std::move(_u));
+      });
+}
+
+/// Parses a JSON var into an existing object. Unlike read(...), this
+/// reuses the memory the object already owns, so reading the same kind of
+/// message over and over again does not have to allocate once the object has
+/// grown large enough. If an error occurs, the object is left in a valid, but
+/// unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, Processors<Ps...>>;
+  const auto r = Reader();
+  const auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses JSON into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::string_view _json_str,
+                          const ReadOptions& _options = ReadOptions()) {
+  yyjson_doc* doc =
+      yyjson_read(_json_str.data(), _json_str.size(), _options.flags());
+  if (!doc) {
+    return Error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  auto res = read_into<Ps...>(_obj, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
+/// Parses JSON into an existing object, reusing the memory the object already
+/// owns. The memory required for parsing is taken from _ctx, which is reset
+/// before parsing, so no memory needs to be allocated at all in the steady
+/// state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::string_view _json_str,
+                          Context& _ctx,
+                          const ReadOptions& _options = ReadOptions()) {
+  _ctx.reset();
+  // yyjson only modifies the input when YYJSON_READ_INSITU is passed.
+  yyjson_doc* doc =
+      yyjson_read_opts(const_cast<char*>(_json_str.data()), _json_str.size(),
+                       _options.flags(), _ctx.allocator(), NULL);
+  if (!doc) {
+    return Error("Could not parse document");
+  }
+  yyjson_val* root = yyjson_doc_get_root(doc);
+  auto res = read_into<Ps...>(_obj, InputVarType(root));
+  yyjson_doc_free(doc);
+  return res;
+}
+
 }  // namespace json
 }  // namespace rfl
 
@@ -0,0 +1,36 @@
+#ifndef RFL_JSON_READ_LINES_HPP_
+#define RFL_JSON_READ_LINES_HPP_
+
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <string>
+
+#include "../Result.hpp"
+#include "Lines.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Returns a lazy range over the objects in newline-delimited JSON, read from
+/// a stream. The stream must outlive the range.
+template <class T, class... Ps>
+Lines<T, Ps...> read_lines(std::istream& _stream) {
+  return Lines<T, Ps...>(&_stream);
+}
+
+/// Returns a lazy range over the objects in a newline-delimited JSON file.
+template <class T, class... Ps>
+Result<Lines<T, Ps...>> load_lines(const std::string& _fname) {
+  auto infile = std::make_unique<std::ifstream>(_fname);
+  if (!infile->is_open()) {
+    return Error("Unable to open file '" + _fname +
+                 "' or file could not be found.");
+  }
+  return Lines<T, Ps...>(std::unique_ptr<std::istream>(std::move(infile)));
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef RFL_JSON_READ_MANY_HPP_
+#define RFL_JSON_READ_MANY_HPP_
+
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../ThreadPool.hpp"
+#include "../internal/read_many.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "Context.hpp"
+#include "read.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Parses a batch of independent JSON documents in parallel, using the
+/// threads in _pool. Every worker has its own Context, which is reused for
+/// all of the documents it parses. The results are returned in the same
+/// order as the documents.
+template <class T, class... Ps>
+std::vector<Result<internal::wrap_in_rfl_array_t<T>>> read_many(
+    const std::span<const std::string_view> _docs, ThreadPool& _pool) {
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+  auto contexts = std::vector<std::unique_ptr<Context>>();
+  for (size_t i = 0; i < _pool.num_workers(); ++i) {
+    contexts.emplace_back(std::make_unique<Context>());
+  }
+  const auto read_one = [&](const size_t _worker, const size_t _i) {
+    return read<T, Ps...>(_docs[_i], *contexts[_worker]);
+  };
+  return internal::read_many<ResultType>(_docs.size(), _pool, read_one);
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
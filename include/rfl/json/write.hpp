@@ -13,7 +13,10 @@
 
 #include "../Processors.hpp"
 #include "../parsing/Parent.hpp"
+#include "Context.hpp"
+#include "DirectWriter.hpp"
 #include "Parser.hpp"
+#include "Reader.hpp"
 
 namespace rfl {
 namespace json {
@@ -35,6 +38,24 @@ std::string write(const auto& _obj, const yyjson_write_flag _flag = 0) {
   return json_str;
 }
 
+/// Returns a JSON string. The memory required for the intermediate document
+/// is taken from _ctx, which is reset before writing.
+template <class... Ps>
+std::string write(const auto& _obj, Context& _ctx,
+                  const yyjson_write_flag _flag = 0) {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<Writer>;
+  _ctx.reset();
+  auto w = Writer(yyjson_mut_doc_new(_ctx.allocator()));
+  Parser<T, Processors<Ps...>>::write(w, _obj, typename ParentType::Root{});
+  size_t len = 0;
+  const char* json_c_str =
+      yyjson_mut_write_opts(w.doc_, _flag, _ctx.allocator(), &len, NULL);
+  auto json_str = json_c_str ? std::string(json_c_str, len) : std::string();
+  yyjson_mut_doc_free(w.doc_);
+  return json_str;
+}
+
 /// Writes a JSON into an ostream.
 template <class... Ps>
 std::ostream& write(const auto& _obj, std::ostream& _stream,
@@ -50,6 +71,37 @@ std::ostream& write(const auto& _obj, std::ostream& _stream,
   return _stream;
 }
 
+/// Returns a JSON string. Unlike write(...), this does not build a yyjson
+/// document, but writes the JSON text directly. The output is identical,
+/// except that NaN and infinity are written as null.
+template <class... Ps>
+std::string write_direct(const auto& _obj, const yyjson_write_flag _flag = 0) {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<DirectWriter>;
+  auto json_str = std::string();
+  const auto w = DirectWriter(&json_str, nullptr,
+                              (_flag & YYJSON_WRITE_PRETTY) != 0);
+  parsing::Parser<Reader, DirectWriter, T, Processors<Ps...>>::write(
+      w, _obj, typename ParentType::Root{});
+  return json_str;
+}
+
+/// Writes a JSON into an ostream. Unlike write(...), this does not build a
+/// yyjson document, but streams the JSON text into the ostream in chunks.
+template <class... Ps>
+std::ostream& write_direct(const auto& _obj, std::ostream& _stream,
+                           const yyjson_write_flag _flag = 0) {
+  using T = std::remove_cvref_t<decltype(_obj)>;
+  using ParentType = parsing::Parent<DirectWriter>;
+  auto buffer = std::string();
+  const auto w =
+      DirectWriter(&buffer, &_stream, (_flag & YYJSON_WRITE_PRETTY) != 0);
+  parsing::Parser<Reader, DirectWriter, T, Processors<Ps...>>::write(
+      w, _obj, typename ParentType::Root{});
+  w.flush();
+  return _stream;
+}
+
 }  // namespace json
 }  // namespace rfl
 
@@ -0,0 +1,60 @@
+#ifndef RFL_JSON_WRITE_LINES_HPP_
+#define RFL_JSON_WRITE_LINES_HPP_
+
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <type_traits>
+
+#include "../Processors.hpp"
+#include "../parsing/Parent.hpp"
+#include "DirectWriter.hpp"
+#include "Parser.hpp"
+#include "Reader.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Writes every element of the range as a single line of JSON into the
+/// ostream (also known as NDJSON or JSON Lines). The output is buffered and
+/// flushed into the stream in chunks, so the range is never held in memory
+/// as a whole.
+template <class... Ps>
+std::ostream& write_lines(const std::ranges::input_range auto& _range,
+                          std::ostream& _stream) {
+  using T = std::remove_cvref_t<std::ranges::range_value_t<decltype(_range)>>;
+  using ParentType = parsing::Parent<DirectWriter>;
+  constexpr size_t flush_threshold = 64 * 1024;
+  auto buffer = std::string();
+  const auto w = DirectWriter(&buffer, &_stream);
+  for (const auto& obj : _range) {
+    parsing::Parser<Reader, DirectWriter, T, Processors<Ps...>>::write(
+        w, obj, typename ParentType::Root{});
+    buffer.push_back('\n');
+    if (buffer.size() > flush_threshold) {
+      w.flush();
+    }
+  }
+  w.flush();
+  return _stream;
+}
+
+/// Returns every element of the range as a single line of JSON.
+template <class... Ps>
+std::string write_lines(const std::ranges::input_range auto& _range) {
+  using T = std::remove_cvref_t<std::ranges::range_value_t<decltype(_range)>>;
+  using ParentType = parsing::Parent<DirectWriter>;
+  auto json_str = std::string();
+  const auto w = DirectWriter(&json_str);
+  for (const auto& obj : _range) {
+    parsing::Parser<Reader, DirectWriter, T, Processors<Ps...>>::write(
+        w, obj, typename ParentType::Root{});
+    json_str.push_back('\n');
+  }
+  return json_str;
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
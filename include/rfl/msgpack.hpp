@@ -4,9 +4,11 @@
 #include "../rfl.hpp"
 #include "msgpack/Parser.hpp"
 #include "msgpack/Reader.hpp"
+#include "msgpack/StreamReader.hpp"
 #include "msgpack/Writer.hpp"
 #include "msgpack/load.hpp"
 #include "msgpack/read.hpp"
+#include "msgpack/read_many.hpp"
 #include "msgpack/save.hpp"
 #include "msgpack/write.hpp"
 
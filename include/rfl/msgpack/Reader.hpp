@@ -3,12 +3,16 @@
 
 #include <msgpack.h>
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <exception>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 #include "../Bytestring.hpp"
 #include "../Result.hpp"
@@ -22,6 +26,8 @@ struct Reader {
   using InputObjectType = msgpack_object_map;
   using InputVarType = msgpack_object;
 
+  static constexpr bool supports_string_views_ = true;
+
   template <class T>
   static constexpr bool has_custom_constructor = (requires(InputVarType var) {
     T::from_msgpack_obj(var);
@@ -33,8 +39,36 @@ struct Reader {
   rfl::Result<InputVarType> get_field_from_object(
       const std::string& _name, const InputObjectType& _obj) const noexcept;
 
+  std::optional<std::pair<std::string_view, InputVarType>> get_first_field(
+      const InputObjectType& _obj) const noexcept;
+
   bool is_empty(const InputVarType& _var) const noexcept;
 
+  size_t size_hint(const InputArrayType& _arr) const noexcept;
+
+  size_t size_hint(const InputObjectType& _obj) const noexcept;
+
+  template <class T>
+  size_t read_numbers(const InputArrayType& _arr,
+                      const std::span<T> _out) const noexcept {
+    const auto size = std::min(static_cast<size_t>(_arr.size), _out.size());
+    for (size_t i = 0; i < size; ++i) {
+      const auto& var = _arr.ptr[i];
+      if (var.type == MSGPACK_OBJECT_FLOAT32 ||
+          var.type == MSGPACK_OBJECT_FLOAT64 ||
+          var.type == MSGPACK_OBJECT_FLOAT) {
+        _out[i] = static_cast<T>(var.via.f64);
+      } else if (var.type == MSGPACK_OBJECT_POSITIVE_INTEGER) {
+        _out[i] = static_cast<T>(var.via.u64);
+      } else if (var.type == MSGPACK_OBJECT_NEGATIVE_INTEGER) {
+        _out[i] = static_cast<T>(var.via.i64);
+      } else {
+        return i;
+      }
+    }
+    return size;
+  }
+
   template <class T>
   rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
     const auto type = _var.type;
@@ -44,6 +78,13 @@ struct Reader {
       }
       const auto str = _var.via.str;
       return std::string(str.ptr, str.size);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      std::string_view>()) {
+      if (type != MSGPACK_OBJECT_STR) {
+        return Error("Could not cast to string.");
+      }
+      const auto str = _var.via.str;
+      return std::string_view(str.ptr, str.size);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>,
                                       rfl::Bytestring>()) {
       if (type != MSGPACK_OBJECT_BIN) {
@@ -52,6 +93,14 @@ struct Reader {
       const auto bin = _var.via.bin;
       return rfl::Bytestring(std::bit_cast<const std::byte*>(bin.ptr),
                              bin.size);
+    } else if constexpr (std::is_same<std::remove_cvref_t<T>,
+                                      rfl::BytestringView>()) {
+      if (type != MSGPACK_OBJECT_BIN) {
+        return Error("Could not cast to a bytestring.");
+      }
+      const auto bin = _var.via.bin;
+      return rfl::BytestringView(std::bit_cast<const std::byte*>(bin.ptr),
+                                 bin.size);
     } else if constexpr (std::is_same<std::remove_cvref_t<T>, bool>()) {
       if (type != MSGPACK_OBJECT_BOOLEAN) {
         return Error("Could not cast to boolean.");
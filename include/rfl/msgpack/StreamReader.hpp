@@ -0,0 +1,101 @@
+#ifndef RFL_MSGPACK_STREAMREADER_HPP_
+#define RFL_MSGPACK_STREAMREADER_HPP_
+
+#include <msgpack.h>
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../internal/wrap_in_rfl_array_t.hpp"
+#include "read.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+/// Parses a sequence of MSGPACK messages that arrive in chunks of arbitrary
+/// size, such as data received over a socket. The bytes are passed to
+/// feed(...) as they arrive and every message is returned by next() as soon
+/// as it is complete. All messages are unpacked into the same zone, which is
+/// cleared, but not freed, between messages.
+///
+/// Messages that are well-formed MSGPACK, but cannot be parsed into T, are
+/// returned as errors and the stream continues with the next message.
+/// Malformed MSGPACK cannot be resynchronized, so the reader stops returning
+/// messages once it has encountered it.
+template <class T, class... Ps>
+class StreamReader {
+  using ResultType = Result<internal::wrap_in_rfl_array_t<T>>;
+
+  struct Deleter {
+    void operator()(msgpack_unpacker* _ptr) const {
+      msgpack_unpacker_free(_ptr);
+    }
+  };
+
+ public:
+  explicit StreamReader(
+      const size_t _initial_buffer_size = MSGPACK_UNPACKER_INIT_BUFFER_SIZE)
+      : unpacker_(msgpack_unpacker_new(_initial_buffer_size)) {}
+
+  /// Appends _size bytes to the internal buffer.
+  Result<Nothing> feed(const char* _bytes, const size_t _size) {
+    if (!unpacker_) {
+      return Error("Could not allocate the MSGPACK unpacker.");
+    }
+    if (failed_) {
+      return Error("The MSGPACK stream is malformed.");
+    }
+    if (!msgpack_unpacker_reserve_buffer(unpacker_.get(), _size)) {
+      return Error("Could not allocate the MSGPACK stream buffer.");
+    }
+    std::memcpy(msgpack_unpacker_buffer(unpacker_.get()), _bytes, _size);
+    msgpack_unpacker_buffer_consumed(unpacker_.get(), _size);
+    return Nothing{};
+  }
+
+  /// Appends _bytes to the internal buffer.
+  Result<Nothing> feed(const std::string_view _bytes) {
+    return feed(_bytes.data(), _bytes.size());
+  }
+
+  /// Appends _bytes to the internal buffer.
+  Result<Nothing> feed(const std::vector<char>& _bytes) {
+    return feed(_bytes.data(), _bytes.size());
+  }
+
+  /// Returns the next complete message or std::nullopt, if more bytes need
+  /// to be fed first.
+  std::optional<ResultType> next() {
+    if (!unpacker_ || failed_) {
+      return std::nullopt;
+    }
+    const auto ret = msgpack_unpacker_execute(unpacker_.get());
+    if (ret == 0) {
+      return std::nullopt;
+    }
+    if (ret < 0) {
+      failed_ = true;
+      return ResultType(Error("The MSGPACK stream is malformed."));
+    }
+    auto res = read<T, Ps...>(msgpack_unpacker_data(unpacker_.get()));
+    msgpack_unpacker_reset_zone(unpacker_.get());
+    msgpack_unpacker_reset(unpacker_.get());
+    return res;
+  }
+
+ private:
+  /// Whether the stream has contained malformed MSGPACK.
+  bool failed_ = false;
+
+  /// The underlying unpacker, which owns the buffer and the zone.
+  std::unique_ptr<msgpack_unpacker, Deleter> unpacker_;
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
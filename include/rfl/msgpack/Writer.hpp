@@ -3,6 +3,7 @@
 
 #include <msgpack.h>
 
+#include <array>
 #include <exception>
 #include <map>
 #include <sstream>
@@ -17,6 +18,7 @@
 #include "../Ref.hpp"
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "../parsing/KeyToken.hpp"
 
 namespace rfl::msgpack {
 
@@ -32,10 +34,47 @@ class Writer {
   using OutputObjectType = MsgpackOutputObject;
   using OutputVarType = MsgpackOutputVar;
 
+  static constexpr bool supports_string_view_values_ = true;
+
   Writer(msgpack_packer* _pk);
 
   ~Writer();
 
+  /// Encodes a key as a msgpack string, meaning the str header, followed by
+  /// the bytes.
+  static constexpr size_t encode_key(const std::string_view _name,
+                                     char* _out) noexcept {
+    const auto size = _name.size();
+    auto header = std::array<unsigned char, 5>{};
+    size_t header_size = 0;
+    if (size < 32) {
+      header = {static_cast<unsigned char>(0xa0 | size)};
+      header_size = 1;
+    } else if (size < 256) {
+      header = {0xd9, static_cast<unsigned char>(size)};
+      header_size = 2;
+    } else if (size < 65536) {
+      header = {0xda, static_cast<unsigned char>(size >> 8),
+                static_cast<unsigned char>(size)};
+      header_size = 3;
+    } else {
+      header = {0xdb, static_cast<unsigned char>(size >> 24),
+                static_cast<unsigned char>(size >> 16),
+                static_cast<unsigned char>(size >> 8),
+                static_cast<unsigned char>(size)};
+      header_size = 5;
+    }
+    if (_out) {
+      for (size_t i = 0; i < header_size; ++i) {
+        _out[i] = static_cast<char>(header[i]);
+      }
+      for (size_t i = 0; i < size; ++i) {
+        _out[header_size + i] = _name[i];
+      }
+    }
+    return header_size + size;
+  }
+
   OutputArrayType array_as_root(const size_t _size) const noexcept;
 
   OutputObjectType object_as_root(const size_t _size) const noexcept;
@@ -54,6 +93,10 @@ class Writer {
       const std::string_view& _name, const size_t _size,
       OutputObjectType* _parent) const noexcept;
 
+  OutputArrayType add_array_to_object(
+      const parsing::KeyToken& _key, const size_t _size,
+      OutputObjectType* _parent) const noexcept;
+
   OutputObjectType add_object_to_array(
       const size_t _size, OutputArrayType* _parent) const noexcept;
 
@@ -61,6 +104,10 @@ class Writer {
       const std::string_view& _name, const size_t _size,
       OutputObjectType* _parent) const noexcept;
 
+  OutputObjectType add_object_to_object(
+      const parsing::KeyToken& _key, const size_t _size,
+      OutputObjectType* _parent) const noexcept;
+
   template <class T>
   OutputVarType add_value_to_array(const T& _var,
                                    OutputArrayType* _parent) const noexcept {
@@ -76,16 +123,33 @@ class Writer {
     return new_value(_var);
   }
 
+  template <class T>
+  OutputVarType add_value_to_object(const parsing::KeyToken& _key,
+                                    const T& _var,
+                                    OutputObjectType* _parent) const noexcept {
+    add_key(_key);
+    return new_value(_var);
+  }
+
   OutputVarType add_null_to_array(OutputArrayType* _parent) const noexcept;
 
   OutputVarType add_null_to_object(const std::string_view& _name,
                                    OutputObjectType* _parent) const noexcept;
 
+  OutputVarType add_null_to_object(const parsing::KeyToken& _key,
+                                   OutputObjectType* _parent) const noexcept;
+
   void end_array(OutputArrayType* _arr) const noexcept;
 
   void end_object(OutputObjectType* _obj) const noexcept;
 
  private:
+  /// msgpack_pack_str_body(...) appends the raw bytes, so we can use it to
+  /// write the pre-encoded header and body in one go.
+  void add_key(const parsing::KeyToken& _key) const noexcept {
+    msgpack_pack_str_body(pk_, _key.encoded_.data(), _key.encoded_.size());
+  }
+
   OutputArrayType new_array(const size_t _size) const noexcept;
 
   OutputObjectType new_object(const size_t _size) const noexcept;
@@ -93,9 +157,10 @@ class Writer {
   template <class T>
   OutputVarType new_value(const T& _var) const noexcept {
     using Type = std::remove_cvref_t<T>;
-    if constexpr (std::is_same<Type, std::string>()) {
+    if constexpr (std::is_same<Type, std::string>() ||
+                  std::is_same<Type, std::string_view>()) {
       msgpack_pack_str(pk_, _var.size());
-      msgpack_pack_str_body(pk_, _var.c_str(), _var.size());
+      msgpack_pack_str_body(pk_, _var.data(), _var.size());
     } else if constexpr (std::is_same<Type, rfl::Bytestring>()) {
       msgpack_pack_bin(pk_, _var.size());
       msgpack_pack_bin_body(pk_, _var.c_str(), _var.size());
@@ -2,7 +2,7 @@
 #define RFL_MSGPACK_LOAD_HPP_
 
 #include "../Result.hpp"
-#include "../io/load_bytes.hpp"
+#include "../io/MappedFile.hpp"
 #include "read.hpp"
 
 namespace rfl {
@@ -10,10 +10,10 @@ namespace msgpack {
 
 template <class T, class... Ps>
 Result<T> load(const std::string& _fname) {
-  const auto read_bytes = [](const auto& _bytes) {
-    return read<T, Ps...>(_bytes);
+  const auto read_file = [](const auto& _file) {
+    return read<T, Ps...>(_file.data(), _file.size());
   };
-  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+  return rfl::io::MappedFile::open(_fname).and_then(read_file);
 }
 
 }  // namespace msgpack
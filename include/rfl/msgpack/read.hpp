@@ -6,8 +6,11 @@
 #include <istream>
 #include <string>
 
+#include "../Borrowed.hpp"
 #include "../Processors.hpp"
+#include "../internal/BorrowFromDocument.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -51,6 +54,73 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(bytes.data(), bytes.size());
 }
 
+/// Parses an object from MSGPACK using reflection. Unlike read(...), this
+/// supports fields of type std::string_view and rfl::BytestringView. The
+/// unpacked document is owned by the returned object, but strings and
+/// bytestrings point directly into _bytes, so _bytes must outlive the object
+/// as well.
+template <class T, class... Ps>
+Result<Borrowed<internal::wrap_in_rfl_array_t<T>>> read_borrowed(
+    const char* _bytes, const size_t _size) {
+  using U = internal::wrap_in_rfl_array_t<T>;
+  msgpack_zone* mempool = msgpack_zone_new(2048);
+  auto handle = typename Borrowed<U>::DocumentType(mempool, [](void* _ptr) {
+    msgpack_zone_free(static_cast<msgpack_zone*>(_ptr));
+  });
+  msgpack_object deserialized;
+  msgpack_unpack(_bytes, _size, NULL, mempool, &deserialized);
+  const auto r = Reader();
+  return Parser<T, Processors<Ps..., internal::BorrowFromDocument>>::read(
+             r, deserialized)
+      .transform([&](U&& _u) {
+        return Borrowed<U>(std::move(handle), std::move(_u));
+      });
+}
+
+/// Parses an object from MSGPACK using reflection. Unlike read(...), this
+/// supports fields of type std::string_view and rfl::BytestringView, which
+/// point directly into _bytes, so _bytes must outlive the object.
+template <class T, class... Ps>
+auto read_borrowed(const std::vector<char>& _bytes) {
+  return read_borrowed<T, Ps...>(_bytes.data(), _bytes.size());
+}
+
+/// Parses a MSGPACK var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses MSGPACK into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const char* _bytes, const size_t _size) {
+  msgpack_zone mempool;
+  msgpack_zone_init(&mempool, 2048);
+  msgpack_object deserialized;
+  msgpack_unpack(_bytes, _size, NULL, &mempool, &deserialized);
+  auto r = read_into<Ps...>(_obj, deserialized);
+  msgpack_zone_destroy(&mempool);
+  return r;
+}
+
+/// Parses MSGPACK into an existing object, reusing the memory the object
+/// already owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::vector<char>& _bytes) {
+  return read_into<Ps...>(_obj, _bytes.data(), _bytes.size());
+}
+
 }  // namespace msgpack
 }  // namespace rfl
 
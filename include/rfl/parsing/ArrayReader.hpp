@@ -10,6 +10,7 @@
 #include "../Result.hpp"
 #include "../internal/is_array.hpp"
 #include "Parser_base.hpp"
+#include "reads_in_place.hpp"
 
 namespace rfl::parsing {
 
@@ -41,13 +42,23 @@ class ArrayReader {
                    " elements, got at least " + std::to_string(size_ + 1) +
                    ".");
     }
-    auto res =
-        Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::read(*r_, _var);
-    if (res) {
-      move_to(&((*array_)[num_set_]), &(*res));
+    using U = std::remove_cvref_t<T>;
+    using ParserType = Parser<R, W, U, ProcessorsType>;
+    if constexpr (reads_in_place<ParserType>) {
+      const auto err = ParserType::read_in_place(
+          *r_, _var, const_cast<U*>(&((*array_)[num_set_])));
+      if (err) {
+        return Error("Failed to parse element " + std::to_string(num_set_) +
+                     ": " + err->what());
+      }
     } else {
-      return Error("Failed to parse element " + std::to_string(num_set_) +
-                   ": " + res.error()->what());
+      auto res = ParserType::read(*r_, _var);
+      if (res) {
+        move_to(&((*array_)[num_set_]), &(*res));
+      } else {
+        return Error("Failed to parse element " + std::to_string(num_set_) +
+                     ": " + res.error()->what());
+      }
     }
     ++num_set_;
     return std::optional<Error>();
@@ -64,10 +64,14 @@ class FieldVariantReader {
         return rfl::Variant<FieldTypes...>(FieldType(std::move(_val)));
       };
       const auto embellish_error = [&](const Error& _e) {
-        std::stringstream stream;
-        stream << "Could not parse rfl::Variant with field '"
-               << std::string(_disc_value) << "': " << _e.what();
-        return Error(stream.str());
+        if constexpr (ProcessorsType::fail_fast_) {
+          return _e;
+        } else {
+          std::stringstream stream;
+          stream << "Could not parse rfl::Variant with field '"
+                 << std::string(_disc_value) << "': " << _e.what();
+          return Error(stream.str());
+        }
       };
       *field_variant_ = Parser<R, W, ValueType, ProcessorsType>::read(*r_, _var)
                             .transform(to_variant)
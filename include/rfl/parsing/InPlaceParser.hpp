@@ -0,0 +1,492 @@
+#ifndef RFL_PARSING_INPLACEPARSER_HPP_
+#define RFL_PARSING_INPLACEPARSER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../Result.hpp"
+#include "../Tuple.hpp"
+#include "../internal/StringHashTable.hpp"
+#include "../internal/is_array.hpp"
+#include "../internal/is_extra_fields.hpp"
+#include "../internal/no_duplicate_field_names.hpp"
+#include "../to_view.hpp"
+#include "Parser.hpp"
+#include "add_field_to_error.hpp"
+#include "is_required.hpp"
+#include "reads_in_place.hpp"
+#include "supports_read_numbers.hpp"
+#include "supports_size_hint.hpp"
+#include "supports_string_views.hpp"
+#include "to_single_error_message.hpp"
+
+namespace rfl::parsing {
+
+/// Reads into an existing object instead of creating a new one, so that the
+/// memory it already owns can be reused: Strings and vectors keep their
+/// capacity, structs are overwritten field by field and the nodes of maps are
+/// recycled. All other types are parsed as usual and then move-assigned.
+///
+/// On success, _t is equal to what Parser<...>::read(...) would have
+/// returned. On failure, _t is left in a valid, but unspecified state.
+template <class R, class W, class T, class ProcessorsType>
+struct InPlaceParser {
+ private:
+  using InputVarType = typename R::InputVarType;
+
+  template <class U>
+  struct is_vector : std::false_type {};
+
+  template <class U>
+  struct is_vector<std::vector<U>>
+      : std::bool_constant<!std::is_same_v<U, bool>> {};
+
+  template <class U>
+  struct is_map : std::false_type {};
+
+  template <class U>
+  struct is_map<std::map<std::string, U>> : std::true_type {};
+
+  template <class U>
+  struct is_map<std::unordered_map<std::string, U>> : std::true_type {};
+
+  template <class U>
+  struct is_optional : std::false_type {};
+
+  template <class U>
+  struct is_optional<std::optional<U>> : std::true_type {};
+
+  template <class U>
+  struct is_std_array : std::false_type {};
+
+  template <class U, size_t _size>
+  struct is_std_array<std::array<U, _size>> : std::true_type {};
+
+  /// Whether Parser_default would read T using read_struct(...). Structs read
+  /// with rfl::DefaultIfMissing or rfl::NoFieldNames are simply reassigned,
+  /// and so are structs for which Parser has been specialized.
+  static constexpr bool is_struct() {
+    if constexpr (std::is_class_v<T> && std::is_aggregate_v<T> &&
+                  !is_std_array<T>::value && !internal::is_extra_fields_v<T> &&
+                  !ProcessorsType::no_field_names_) {
+      return reads_in_place<Parser<R, W, T, ProcessorsType>>;
+    } else {
+      return false;
+    }
+  }
+
+ public:
+  static_assert(std::is_move_assignable_v<T> || std::is_array_v<T>,
+                "Only types that can be assigned to can be read into.");
+
+  static std::optional<Error> read_into(const R& _r, const InputVarType& _var,
+                                        T* _t) noexcept {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return read_string(_r, _var, _t);
+    } else if constexpr (is_vector<T>::value) {
+      return read_vector(_r, _var, _t);
+    } else if constexpr (is_map<T>::value) {
+      return read_map(_r, _var, _t);
+    } else if constexpr (is_optional<T>::value) {
+      return read_optional(_r, _var, _t);
+    } else if constexpr (is_struct()) {
+      return read_struct(_r, _var, _t);
+    } else {
+      return read_and_assign(_r, _var, _t);
+    }
+  }
+
+ private:
+  /// Reads the elements of a vector, overwriting the existing elements first.
+  class ElementReader {
+    using ValueType = typename T::value_type;
+
+   public:
+    ElementReader(const R* _r, T* _vec) : num_read_(0), r_(_r), vec_(_vec) {}
+
+    std::optional<Error> read(const InputVarType& _var) const {
+      if (num_read_ < vec_->size()) {
+        auto err =
+            InPlaceParser<R, W, ValueType, ProcessorsType>::read_into(
+                *r_, _var, &(*vec_)[num_read_]);
+        if (err) {
+          return err;
+        }
+      } else {
+        auto res = Parser<R, W, ValueType, ProcessorsType>::read(*r_, _var);
+        if (!res) {
+          return res.error();
+        }
+        vec_->emplace_back(std::move(*res));
+      }
+      ++num_read_;
+      return std::nullopt;
+    }
+
+    size_t num_read() const { return num_read_; }
+
+   private:
+    /// The number of elements read so far.
+    mutable size_t num_read_;
+
+    const R* r_;
+
+    T* vec_;
+  };
+
+  /// Reads the entries of a map, taking the nodes from the old map.
+  class EntryReader {
+    using ValueType = typename T::mapped_type;
+
+   public:
+    EntryReader(const R* _r, T* _map, T* _old, std::vector<Error>* _errors)
+        : r_(_r), map_(_map), old_(_old), errors_(_errors) {}
+
+    void read(const std::string_view& _name, const InputVarType& _var) const {
+      if constexpr (ProcessorsType::fail_fast_) {
+        if (!errors_->empty()) {
+          return;
+        }
+      }
+      key_.assign(_name.data(), _name.size());
+      auto node = old_->extract(key_);
+      if (node.empty() && !old_->empty()) {
+        node = old_->extract(old_->begin());
+        node.key().assign(_name.data(), _name.size());
+      }
+      if (node.empty()) {
+        auto res = Parser<R, W, ValueType, ProcessorsType>::read(*r_, _var);
+        if (!res) {
+          errors_->emplace_back(add_field_to_error<ProcessorsType>(
+              _name, std::move(*res.error())));
+          return;
+        }
+        map_->emplace(key_, std::move(*res));
+        return;
+      }
+      auto err =
+          InPlaceParser<R, W, ValueType, ProcessorsType>::read_into(
+              *r_, _var, &node.mapped());
+      if (err) {
+        errors_->emplace_back(
+            add_field_to_error<ProcessorsType>(_name, std::move(*err)));
+        return;
+      }
+      map_->insert(std::move(node));
+    }
+
+   private:
+    const R* r_;
+
+    /// The map we are reading into.
+    T* map_;
+
+    /// The previous content of the map, whose nodes we reuse.
+    T* old_;
+
+    std::vector<Error>* errors_;
+
+    /// Used to look up keys in old_ without allocating memory every time.
+    mutable std::string key_;
+  };
+
+  /// Reads the fields of a struct through its view.
+  template <class ViewType>
+  class FieldReader {
+    static constexpr size_t size_ = ViewType::size();
+
+   public:
+    FieldReader(const R* _r, ViewType* _view, std::array<bool, size_>* _found,
+                std::vector<Error>* _errors)
+        : r_(_r), view_(_view), found_(_found), errors_(_errors) {}
+
+    /// Signals to the readers that this assigns the fields of a struct.
+    static constexpr bool reads_struct_fields_ = true;
+
+    void read(const std::string_view& _name, const InputVarType& _var) const {
+      if constexpr (ProcessorsType::fail_fast_) {
+        if (!errors_->empty()) {
+          return;
+        }
+      }
+      const auto ix = field_indices_.find(_name);
+      if (ix != -1 && !(*found_)[ix]) {
+        (*found_)[ix] = true;
+        read_field_functions_[ix](*r_, _var, view_, errors_);
+        return;
+      }
+      if constexpr (ViewType::pos_extra_fields() != -1) {
+        constexpr int pos = ViewType::pos_extra_fields();
+        read_extra_field<pos>(_name, _var);
+      } else if constexpr (ProcessorsType::no_extra_fields_) {
+        std::stringstream stream;
+        stream << "Value named '" << _name
+               << "' not used. Remove the rfl::NoExtraFields processor or add "
+                  "rfl::ExtraFields to avoid this error message.";
+        errors_->emplace_back(Error(stream.str()));
+      }
+    }
+
+   private:
+    using ReadFieldFunction = void (*)(const R&, const InputVarType&,
+                                       ViewType*, std::vector<Error>*);
+
+    template <int _i>
+    static void read_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors) {
+      using FieldType = tuple_element_t<_i, typename ViewType::Fields>;
+      using OriginalType = typename FieldType::Type;
+      using U = std::remove_cvref_t<std::remove_pointer_t<OriginalType>>;
+      constexpr auto name = FieldType::name();
+      if constexpr (std::is_pointer_v<OriginalType>) {
+        auto err = InPlaceParser<R, W, U, ProcessorsType>::read_into(
+            _r, _var, rfl::get<_i>(*_view));
+        if (err) {
+          _errors->emplace_back(
+              add_field_to_error<ProcessorsType>(name, std::move(*err)));
+        }
+      } else {
+        auto res = Parser<R, W, U, ProcessorsType>::read(_r, _var);
+        if (!res) {
+          _errors->emplace_back(add_field_to_error<ProcessorsType>(
+              name, std::move(*res.error())));
+          return;
+        }
+        rfl::get<_i>(*_view) = std::move(*res);
+      }
+    }
+
+    template <int _pos>
+    void read_extra_field(const std::string_view& _name,
+                          const InputVarType& _var) const {
+      auto* extra_fields = rfl::get<_pos>(*view_);
+      using ExtraFieldsType =
+          std::remove_cvref_t<std::remove_pointer_t<decltype(extra_fields)>>;
+      using U = std::remove_cvref_t<typename ExtraFieldsType::Type>;
+      auto res = Parser<R, W, U, ProcessorsType>::read(*r_, _var);
+      if (!res) {
+        errors_->emplace_back(add_field_to_error<ProcessorsType>(
+            _name, std::move(*res.error())));
+        return;
+      }
+      extra_fields->emplace(std::string(_name), std::move(*res));
+    }
+
+    template <int... _is>
+    static constexpr auto make_read_field_functions(
+        std::integer_sequence<int, _is...>) {
+      return std::array<ReadFieldFunction, size_>{&read_field<_is>...};
+    }
+
+    template <int... _is>
+    static constexpr auto make_field_indices(
+        std::integer_sequence<int, _is...>) {
+      return internal::StringHashTable<size_>(
+          std::array<std::string_view, size_>{
+              tuple_element_t<_is, typename ViewType::Fields>::name()...});
+    }
+
+    /// Maps the field names to their index at compile time.
+    static constexpr auto field_indices_ =
+        make_field_indices(std::make_integer_sequence<int, size_>());
+
+    /// The functions used to read the fields, indexed by the field index.
+    static constexpr auto read_field_functions_ =
+        make_read_field_functions(std::make_integer_sequence<int, size_>());
+
+    const R* r_;
+
+    ViewType* view_;
+
+    std::array<bool, size_>* found_;
+
+    std::vector<Error>* errors_;
+  };
+
+  static std::optional<Error> read_string(const R& _r, const InputVarType& _var,
+                                          T* _t) {
+    if constexpr (supports_string_views<R>) {
+      const auto str = _r.template to_basic_type<std::string_view>(_var);
+      if (str) {
+        _t->assign(*str);
+        return std::nullopt;
+      }
+    }
+    return read_and_assign(_r, _var, _t);
+  }
+
+  static std::optional<Error> read_vector(const R& _r, const InputVarType& _var,
+                                          T* _t) {
+    using ValueType = typename T::value_type;
+    auto arr = _r.to_array(_var);
+    if (!arr) {
+      return arr.error();
+    }
+    if constexpr (supports_read_numbers<R, ValueType>) {
+      _t->resize(_r.size_hint(*arr));
+      if (!_t->empty() &&
+          _r.read_numbers(*arr, std::span<ValueType>(*_t)) == _t->size()) {
+        return std::nullopt;
+      }
+      // Take the slow path to produce the appropriate error message.
+    }
+    reserve_from_size_hint(_r, *arr, _t);
+    const auto element_reader = ElementReader(&_r, _t);
+    const auto err = _r.read_array(element_reader, *arr);
+    if (err) {
+      return err;
+    }
+    _t->erase(_t->begin() + element_reader.num_read(), _t->end());
+    return std::nullopt;
+  }
+
+  static std::optional<Error> read_map(const R& _r, const InputVarType& _var,
+                                       T* _t) {
+    auto obj = _r.to_object(_var);
+    if (!obj) {
+      return obj.error();
+    }
+    auto old = std::move(*_t);
+    _t->clear();
+    reserve_from_size_hint(_r, *obj, _t);
+    std::vector<Error> errors;
+    const auto entry_reader = EntryReader(&_r, _t, &old, &errors);
+    const auto err = _r.read_object(entry_reader, *obj);
+    if (err) {
+      return err;
+    }
+    if (errors.size() != 0) {
+      return to_single_error_message(errors);
+    }
+    return std::nullopt;
+  }
+
+  static std::optional<Error> read_optional(const R& _r,
+                                            const InputVarType& _var, T* _t) {
+    using ValueType = std::remove_cvref_t<typename T::value_type>;
+    if (_r.is_empty(_var)) {
+      _t->reset();
+      return std::nullopt;
+    }
+    if (!_t->has_value()) {
+      return read_and_assign(_r, _var, _t);
+    }
+    return InPlaceParser<R, W, ValueType, ProcessorsType>::read_into(_r, _var,
+                                                                     &**_t);
+  }
+
+  static std::optional<Error> read_struct(const R& _r, const InputVarType& _var,
+                                          T* _t) {
+    auto view = ProcessorsType::template process<T>(to_view(*_t));
+    using ViewType = std::remove_cvref_t<decltype(view)>;
+    static_assert(
+        internal::no_duplicate_field_names<typename ViewType::Fields>());
+    auto obj = _r.to_object(_var);
+    if (!obj) {
+      return obj.error();
+    }
+    if constexpr (ViewType::pos_extra_fields() != -1) {
+      auto* extra_fields = rfl::get<ViewType::pos_extra_fields()>(view);
+      *extra_fields = std::remove_cvref_t<decltype(*extra_fields)>();
+    }
+    auto found = std::array<bool, ViewType::size()>();
+    found.fill(false);
+    std::vector<Error> errors;
+    const auto field_reader =
+        FieldReader<ViewType>(&_r, &view, &found, &errors);
+    const auto err = _r.read_object(field_reader, *obj);
+    if (err) {
+      return err;
+    }
+    handle_missing_fields(found, &view, &errors,
+                          std::make_integer_sequence<int, ViewType::size()>());
+    if (errors.size() != 0) {
+      return to_single_error_message(errors);
+    }
+    return std::nullopt;
+  }
+
+  /// Fields that are missing are either reset or generate an error, just like
+  /// they would when reading a new object.
+  template <class ViewType, int... _is>
+  static void handle_missing_fields(
+      const std::array<bool, ViewType::size()>& _found, ViewType* _view,
+      std::vector<Error>* _errors, std::integer_sequence<int, _is...>) {
+    (handle_one_missing_field<_is>(_found, _view, _errors), ...);
+  }
+
+  template <int _i, class ViewType>
+  static void handle_one_missing_field(
+      const std::array<bool, ViewType::size()>& _found, ViewType* _view,
+      std::vector<Error>* _errors) {
+    using FieldType = tuple_element_t<_i, typename ViewType::Fields>;
+    using OriginalType = typename FieldType::Type;
+    using ValueType = std::remove_cvref_t<std::remove_pointer_t<OriginalType>>;
+    using NamedTupleParserType = Parser<R, W, ViewType, ProcessorsType>;
+    constexpr bool is_required_field =
+        !internal::is_extra_fields_v<ValueType> &&
+        (NamedTupleParserType::all_required_ ||
+         is_required<ValueType,
+                     NamedTupleParserType::ignore_empty_containers_>());
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!_errors->empty()) {
+        return;
+      }
+    }
+    if (std::get<_i>(_found)) {
+      return;
+    }
+    if constexpr (is_required_field) {
+      std::stringstream stream;
+      stream << "Field named '" << std::string(FieldType::name())
+             << "' not found.";
+      _errors->emplace_back(Error(stream.str()));
+    } else if constexpr (std::is_pointer_v<OriginalType> &&
+                         !internal::is_extra_fields_v<ValueType>) {
+      *rfl::get<_i>(*_view) = ValueType();
+    }
+  }
+
+  static std::optional<Error> read_and_assign(const R& _r,
+                                              const InputVarType& _var,
+                                              T* _t) {
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      return res.error();
+    }
+    move_to(_t, &(*res));
+    return std::nullopt;
+  }
+
+  template <class Target, class Source>
+  static void move_to(Target* _t, Source* _s) {
+    if constexpr (!rfl::internal::is_array_v<Source> &&
+                  !std::is_array_v<Target>) {
+      *_t = std::move(*_s);
+    } else if constexpr (rfl::internal::is_array_v<Source>) {
+      static_assert(std::is_array_v<Target>,
+                    "Expected target to be a c-array.");
+      for (size_t i = 0; i < _s->arr_.size(); ++i) {
+        move_to(&((*_t)[i]), &(_s->arr_[i]));
+      }
+    } else {
+      for (size_t i = 0; i < _s->size(); ++i) {
+        move_to(&((*_t)[i]), &((*_s)[i]));
+      }
+    }
+  }
+};
+
+}  // namespace rfl::parsing
+
+#endif
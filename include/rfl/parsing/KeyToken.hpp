@@ -0,0 +1,50 @@
+#ifndef RFL_PARSING_KEYTOKEN_HPP_
+#define RFL_PARSING_KEYTOKEN_HPP_
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "../internal/StringLiteral.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// The name of a field, along with its representation in the output format.
+/// For field names known at compile time, writers supporting key tokens
+/// encode the name once at compile time (including any quoting, escaping or
+/// length prefixes), so it can be copied into the output as is.
+struct KeyToken {
+  /// The field name, as it would be passed to the writer otherwise.
+  std::string_view name_;
+
+  /// The field name, encoded by W::encode_key(...). The underlying memory
+  /// has static storage duration.
+  std::string_view encoded_;
+};
+
+/// Contains the key token for _name, encoded by the writer W.
+template <class W, internal::StringLiteral _name>
+struct EncodedKey {
+  static constexpr size_t size_ = W::encode_key(_name.string_view(), nullptr);
+
+  static constexpr std::array<char, size_> make_encoded() {
+    auto arr = std::array<char, size_>{};
+    W::encode_key(_name.string_view(), arr.data());
+    return arr;
+  }
+
+  static constexpr std::array<char, size_> encoded_ = make_encoded();
+
+  static constexpr KeyToken token_ =
+      KeyToken{.name_ = _name.string_view(),
+               .encoded_ = std::string_view(encoded_.data(), size_)};
+};
+
+template <class W, internal::StringLiteral _name>
+inline constexpr KeyToken key_token_v = EncodedKey<W, _name>::token_;
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -13,6 +13,7 @@
 #include "Parent.hpp"
 #include "Parser_base.hpp"
 #include "schema/Type.hpp"
+#include "supports_size_hint.hpp"
 #include "to_single_error_message.hpp"
 
 namespace rfl {
@@ -82,6 +83,7 @@ struct MapParser {
  private:
   static Result<MapType> make_map(const R& _r, const InputObjectType& _obj) {
     MapType map;
+    reserve_from_size_hint(_r, _obj, &map);
     std::vector<Error> errors;
     const auto map_reader =
         MapReader<R, W, MapType, ProcessorsType>(&_r, &map, &errors);
@@ -9,6 +9,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
+#include "add_field_to_error.hpp"
 
 namespace rfl::parsing {
 
@@ -28,12 +29,17 @@ class MapReader {
 
   void read(const std::string_view& _name,
             const InputVarType& _var) const noexcept {
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!errors_->empty()) {
+        return;
+      }
+    }
     auto res = get_pair(_name, _var);
     if (res) {
       map_->emplace(std::move(*res));
     } else {
-      errors_->push_back(Error("Failed to parse field '" + std::string(_name) +
-                               "': " + res.error()->what()));
+      errors_->push_back(
+          add_field_to_error<ProcessorsType>(_name, std::move(*res.error())));
     }
   }
 
@@ -23,6 +23,7 @@
 #include "../internal/strings/replace_all.hpp"
 #include "../to_view.hpp"
 #include "AreReaderAndWriter.hpp"
+#include "KeyToken.hpp"
 #include "Parent.hpp"
 #include "Parser_base.hpp"
 #include "ViewReader.hpp"
@@ -32,6 +33,7 @@
 #include "call_destructors_where_necessary.hpp"
 #include "is_empty.hpp"
 #include "is_required.hpp"
+#include "supports_key_tokens.hpp"
 #include "schema/Type.hpp"
 #include "to_single_error_message.hpp"
 
@@ -71,6 +73,12 @@ struct NamedTupleParser {
 
   static constexpr size_t size_ = NamedTupleType::size();
 
+  /// Whether missing fields are errors, even if they are optional.
+  static constexpr bool all_required_ = _all_required;
+
+  /// Whether empty containers count as optional.
+  static constexpr bool ignore_empty_containers_ = _ignore_empty_containers;
+
   static_assert(NamedTupleType::pos_extra_fields() == -1 || !_no_field_names,
                 "You cannot use the rfl::NoFieldNames processor if you are "
                 "including rfl::ExtraFields.");
@@ -183,8 +191,7 @@ struct NamedTupleParser {
       }
     } else if constexpr (!_all_required && !_no_field_names &&
                          !is_required<ValueType, _ignore_empty_containers>()) {
-      constexpr auto name = FieldType::name_.string_view();
-      const auto new_parent = make_parent(name, _ptr);
+      const auto new_parent = make_parent<FieldType::name_>(_ptr);
       if (!is_empty(value)) {
         if constexpr (internal::is_attribute_v<ValueType>) {
           Parser<R, W, ValueType, ProcessorsType>::write(
@@ -194,8 +201,7 @@ struct NamedTupleParser {
         }
       }
     } else {
-      constexpr auto name = FieldType::name_.string_view();
-      const auto new_parent = make_parent(name, _ptr);
+      const auto new_parent = make_parent<FieldType::name_>(_ptr);
       if constexpr (internal::is_attribute_v<ValueType>) {
         Parser<R, W, ValueType, ProcessorsType>::write(
             _w, value, new_parent.as_attribute());
@@ -254,6 +260,11 @@ struct NamedTupleParser {
     using ValueType = std::remove_reference_t<
         std::remove_pointer_t<typename FieldType::Type>>;
 
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!_errors->empty()) {
+        return;
+      }
+    }
     if (!std::get<_i>(_found)) {
       constexpr bool is_required_field =
           !internal::is_extra_fields_v<ValueType> &&
@@ -295,6 +306,22 @@ struct NamedTupleParser {
     }
   }
 
+  /// Field names known at compile time are also encoded at compile time, if
+  /// the writer supports that.
+  template <internal::StringLiteral _name>
+  static auto make_parent(OutputObjectOrArrayType* _ptr) {
+    if constexpr (_no_field_names) {
+      return typename ParentType::Array{_ptr};
+    } else if constexpr (supports_key_tokens<W>) {
+      return typename ParentType::Object{
+          .name_ = _name.string_view(),
+          .obj_ = _ptr,
+          .encoded_name_ = key_token_v<W, _name>.encoded_};
+    } else {
+      return typename ParentType::Object{_name.string_view(), _ptr};
+    }
+  }
+
   static std::pair<std::array<bool, NamedTupleType::size()>,
                    std::optional<Error>>
   read_object_or_array(const R& _r, const InputObjectOrArrayType& _obj_or_arr,
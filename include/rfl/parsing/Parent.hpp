@@ -1,12 +1,15 @@
 #ifndef RFL_PARSING_PARENT_HPP_
 #define RFL_PARSING_PARENT_HPP_
 
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 
 #include "../always_false.hpp"
+#include "KeyToken.hpp"
 #include "supports_attributes.hpp"
+#include "supports_key_tokens.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -25,7 +28,10 @@ struct Parent {
     std::string_view name_;
     OutputObjectType* obj_;
     bool is_attribute_ = false;
-    Object as_attribute() const { return Object{name_, obj_, true}; }
+    std::string_view encoded_name_ = std::string_view();
+    Object as_attribute() const {
+      return Object{name_, obj_, true, encoded_name_};
+    }
   };
 
   struct Root {};
@@ -37,6 +43,12 @@ struct Parent {
     if constexpr (std::is_same<Type, Array>()) {
       return _w.add_array_to_array(_size, _parent.arr_);
     } else if constexpr (std::is_same<Type, Object>()) {
+      if constexpr (supports_key_tokens<W>) {
+        if (!_parent.encoded_name_.empty()) {
+          return _w.add_array_to_object(key_token(_parent), _size,
+                                        _parent.obj_);
+        }
+      }
       return _w.add_array_to_object(_parent.name_, _size, _parent.obj_);
     } else if constexpr (std::is_same<Type, Root>()) {
       return _w.array_as_root(_size);
@@ -52,6 +64,12 @@ struct Parent {
     if constexpr (std::is_same<Type, Array>()) {
       return _w.add_object_to_array(_size, _parent.arr_);
     } else if constexpr (std::is_same<Type, Object>()) {
+      if constexpr (supports_key_tokens<W>) {
+        if (!_parent.encoded_name_.empty()) {
+          return _w.add_object_to_object(key_token(_parent), _size,
+                                         _parent.obj_);
+        }
+      }
       return _w.add_object_to_object(_parent.name_, _size, _parent.obj_);
     } else if constexpr (std::is_same<Type, Root>()) {
       return _w.object_as_root(_size);
@@ -69,6 +87,11 @@ struct Parent {
       if constexpr (supports_attributes<std::remove_cvref_t<W>>) {
         return _w.add_null_to_object(_parent.name_, _parent.obj_,
                                      _parent.is_attribute_);
+      } else if constexpr (supports_key_tokens<std::remove_cvref_t<W>>) {
+        if (!_parent.encoded_name_.empty()) {
+          return _w.add_null_to_object(key_token(_parent), _parent.obj_);
+        }
+        return _w.add_null_to_object(_parent.name_, _parent.obj_);
       } else {
         return _w.add_null_to_object(_parent.name_, _parent.obj_);
       }
@@ -79,6 +102,23 @@ struct Parent {
     }
   }
 
+  /// Only available for writers satisfying supports_write_numbers.
+  template <class ParentType, class T>
+  static OutputVarType add_numbers(const W& _w,
+                                   const std::span<const T> _numbers,
+                                   const ParentType& _parent) {
+    using Type = std::remove_cvref_t<ParentType>;
+    if constexpr (std::is_same<Type, Array>()) {
+      return _w.add_numbers_to_array(_numbers, _parent.arr_);
+    } else if constexpr (std::is_same<Type, Object>()) {
+      return _w.add_numbers_to_object(_parent.name_, _numbers, _parent.obj_);
+    } else if constexpr (std::is_same<Type, Root>()) {
+      return _w.numbers_as_root(_numbers);
+    } else {
+      static_assert(always_false_v<Type>, "Unsupported option.");
+    }
+  }
+
   template <class ParentType, class T>
   static OutputVarType add_value(const W& _w, const T& _var,
                                  const ParentType& _parent) {
@@ -89,6 +129,12 @@ struct Parent {
       if constexpr (supports_attributes<std::remove_cvref_t<W>>) {
         return _w.add_value_to_object(_parent.name_, _var, _parent.obj_,
                                       _parent.is_attribute_);
+      } else if constexpr (supports_key_tokens<std::remove_cvref_t<W>>) {
+        if (!_parent.encoded_name_.empty()) {
+          return _w.add_value_to_object(key_token(_parent), _var,
+                                        _parent.obj_);
+        }
+        return _w.add_value_to_object(_parent.name_, _var, _parent.obj_);
       } else {
         return _w.add_value_to_object(_parent.name_, _var, _parent.obj_);
       }
@@ -98,6 +144,11 @@ struct Parent {
       static_assert(always_false_v<Type>, "Unsupported option.");
     }
   }
+
+ private:
+  static KeyToken key_token(const Object& _parent) {
+    return KeyToken{.name_ = _parent.name_, .encoded_ = _parent.encoded_name_};
+  }
 };
 
 }  // namespace parsing
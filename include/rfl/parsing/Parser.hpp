@@ -4,7 +4,9 @@
 #include "Parser_array.hpp"
 #include "Parser_base.hpp"
 #include "Parser_box.hpp"
+#include "Parser_bytestring_view.hpp"
 #include "Parser_c_array.hpp"
+#include "Parser_compact_generic.hpp"
 #include "Parser_default.hpp"
 #include "Parser_filepath.hpp"
 #include "Parser_map_like.hpp"
@@ -21,6 +23,7 @@
 #include "Parser_rfl_variant.hpp"
 #include "Parser_shared_ptr.hpp"
 #include "Parser_skip.hpp"
+#include "Parser_span.hpp"
 #include "Parser_string_view.hpp"
 #include "Parser_tagged_union.hpp"
 #include "Parser_tuple.hpp"
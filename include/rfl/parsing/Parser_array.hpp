@@ -4,6 +4,7 @@
 #include <array>
 #include <bit>
 #include <map>
+#include <span>
 #include <type_traits>
 #include <vector>
 
@@ -15,6 +16,8 @@
 #include "Parser_base.hpp"
 #include "call_destructors_on_array_where_necessary.hpp"
 #include "schema/Type.hpp"
+#include "supports_read_numbers.hpp"
+#include "supports_write_numbers.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -31,6 +34,14 @@ struct Parser<R, W, std::array<T, _size>, ProcessorsType> {
                                            const InputVarType& _var) noexcept {
     const auto parse =
         [&](const InputArrayType& _arr) -> Result<std::array<T, _size>> {
+      if constexpr (_size != 0 && supports_read_numbers<R, T>) {
+        std::array<T, _size> arr;
+        if (_r.size_hint(_arr) == _size &&
+            _r.read_numbers(_arr, std::span<T>(arr)) == _size) {
+          return arr;
+        }
+        // Take the slow path to produce the appropriate error message.
+      }
       alignas(
           std::array<T, _size>) unsigned char buf[sizeof(std::array<T, _size>)];
       auto ptr = std::bit_cast<std::array<T, _size>*>(&buf);
@@ -57,13 +68,17 @@ struct Parser<R, W, std::array<T, _size>, ProcessorsType> {
   template <class P>
   static void write(const W& _w, const std::array<T, _size>& _arr,
                     const P& _parent) noexcept {
-    auto arr = ParentType::add_array(_w, _size, _parent);
-    const auto new_parent = typename ParentType::Array{&arr};
-    for (const auto& e : _arr) {
-      Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::write(_w, e,
-                                                                  new_parent);
+    if constexpr (supports_write_numbers<W, T>) {
+      ParentType::add_numbers(_w, std::span<const T>(_arr), _parent);
+    } else {
+      auto arr = ParentType::add_array(_w, _size, _parent);
+      const auto new_parent = typename ParentType::Array{&arr};
+      for (const auto& e : _arr) {
+        Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::write(
+            _w, e, new_parent);
+      }
+      _w.end_array(&arr);
     }
-    _w.end_array(&arr);
   }
 
   static schema::Type to_schema(
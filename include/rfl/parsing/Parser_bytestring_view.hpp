@@ -0,0 +1,52 @@
+#ifndef RFL_PARSING_PARSER_BYTESTRING_VIEW_HPP_
+#define RFL_PARSING_PARSER_BYTESTRING_VIEW_HPP_
+
+#include <map>
+#include <string>
+
+#include "../Bytestring.hpp"
+#include "../Result.hpp"
+#include "../always_false.hpp"
+#include "Parser_base.hpp"
+#include "schema/Type.hpp"
+
+namespace rfl {
+namespace parsing {
+
+template <class R, class W, class ProcessorsType>
+requires AreReaderAndWriter<R, W, BytestringView>
+struct Parser<R, W, BytestringView, ProcessorsType> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<BytestringView> read(const R& _r,
+                                     const InputVarType& _var) noexcept {
+    if constexpr (!ProcessorsType::borrow_from_document_) {
+      static_assert(always_false_v<R>,
+                    "Reading into rfl::BytestringView is dangerous and "
+                    "therefore unsupported by read(...). "
+                    "Please consider using rfl::Bytestring instead or use "
+                    "read_borrowed(...), which keeps the underlying "
+                    "document alive for as long as the object.");
+      return Error("Unsupported.");
+    } else {
+      return _r.template to_basic_type<BytestringView>(_var);
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const BytestringView& _bytes,
+                    const P& _p) noexcept {
+    Parser<R, W, Bytestring, ProcessorsType>::write(
+        _w, Bytestring(_bytes.data(), _bytes.size()), _p);
+  }
+
+  static schema::Type to_schema(
+      std::map<std::string, schema::Type>* _definitions) {
+    return Parser<R, W, Bytestring, ProcessorsType>::to_schema(_definitions);
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
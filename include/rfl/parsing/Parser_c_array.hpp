@@ -2,6 +2,7 @@
 #define RFL_PARSING_PARSER_C_ARRAY_HPP_
 
 #include <map>
+#include <span>
 #include <type_traits>
 
 #include "../Result.hpp"
@@ -12,6 +13,7 @@
 #include "Parser_array.hpp"
 #include "Parser_base.hpp"
 #include "schema/Type.hpp"
+#include "supports_write_numbers.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -35,13 +37,17 @@ struct Parser<R, W, T[_size], ProcessorsType> {
   template <class P>
   static void write(const W& _w, const CArray& _arr,
                     const P& _parent) noexcept {
-    auto arr = ParentType::add_array(_w, _size, _parent);
-    const auto new_parent = typename ParentType::Array{&arr};
-    for (const auto& e : _arr) {
-      Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::write(_w, e,
-                                                                  new_parent);
+    if constexpr (supports_write_numbers<W, T>) {
+      ParentType::add_numbers(_w, std::span<const T>(_arr), _parent);
+    } else {
+      auto arr = ParentType::add_array(_w, _size, _parent);
+      const auto new_parent = typename ParentType::Array{&arr};
+      for (const auto& e : _arr) {
+        Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::write(
+            _w, e, new_parent);
+      }
+      _w.end_array(&arr);
     }
-    _w.end_array(&arr);
   }
 
   static schema::Type to_schema(
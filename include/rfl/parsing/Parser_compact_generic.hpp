@@ -0,0 +1,220 @@
+#ifndef RFL_PARSING_PARSER_COMPACT_GENERIC_HPP_
+#define RFL_PARSING_PARSER_COMPACT_GENERIC_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../CompactGeneric.hpp"
+#include "../Generic.hpp"
+#include "../Result.hpp"
+#include "Parent.hpp"
+#include "Parser_base.hpp"
+#include "add_field_to_error.hpp"
+#include "schema/Type.hpp"
+#include "supports_string_views.hpp"
+#include "to_single_error_message.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Reads the input straight into the arena of an rfl::CompactGeneric,
+/// without building an rfl::Generic first.
+template <class R, class W, class ProcessorsType>
+requires AreReaderAndWriter<R, W, CompactGeneric>
+struct Parser<R, W, CompactGeneric, ProcessorsType> {
+  using InputVarType = typename R::InputVarType;
+
+  using ParentType = Parent<W>;
+
+  static Result<CompactGeneric> read(const R& _r,
+                                     const InputVarType& _var) noexcept {
+    auto builder = CompactGeneric::Builder();
+    const auto err = read_value(_r, _var, std::string_view(), &builder);
+    if (err) {
+      return *err;
+    }
+    return builder.build();
+  }
+
+  template <class P>
+  static void write(const W& _w, const CompactGeneric& _g,
+                    const P& _parent) noexcept {
+    write_value(_w, _g.get(), _parent);
+  }
+
+  static schema::Type to_schema(
+      std::map<std::string, schema::Type>* _definitions) {
+    return Parser<R, W, Generic, ProcessorsType>::to_schema(_definitions);
+  }
+
+ private:
+  class ArrayReader {
+   public:
+    ArrayReader(const R* _r, CompactGeneric::Builder* _builder)
+        : builder_(_builder), r_(_r) {}
+
+    std::optional<Error> read(const InputVarType& _var) const noexcept {
+      return read_value(*r_, _var, std::string_view(), builder_);
+    }
+
+   private:
+    CompactGeneric::Builder* builder_;
+    const R* r_;
+  };
+
+  class ObjectReader {
+   public:
+    ObjectReader(const R* _r, CompactGeneric::Builder* _builder,
+                 std::vector<Error>* _errors)
+        : builder_(_builder), errors_(_errors), r_(_r) {}
+
+    void read(const std::string_view& _name,
+              const InputVarType& _var) const noexcept {
+      if constexpr (ProcessorsType::fail_fast_) {
+        if (!errors_->empty()) {
+          return;
+        }
+      }
+      auto err = read_value(*r_, _var, _name, builder_);
+      if (err) {
+        errors_->emplace_back(
+            add_field_to_error<ProcessorsType>(_name, std::move(*err)));
+      }
+    }
+
+   private:
+    CompactGeneric::Builder* builder_;
+    std::vector<Error>* errors_;
+    const R* r_;
+  };
+
+  /// Determines the type of _var by trying the same types in the same order
+  /// as rfl::Generic does, except that integers have 64 bits.
+  static std::optional<Error> read_value(
+      const R& _r, const InputVarType& _var, const std::string_view _key,
+      CompactGeneric::Builder* _builder) noexcept {
+    if (_r.is_empty(_var)) {
+      _builder->add_null(_key);
+      return std::nullopt;
+    }
+
+    if (const auto b = _r.template to_basic_type<bool>(_var)) {
+      _builder->add_bool(_key, *b);
+      return std::nullopt;
+    }
+
+    if (const auto i = _r.template to_basic_type<int64_t>(_var)) {
+      _builder->add_int(_key, *i);
+      return std::nullopt;
+    }
+
+    if (const auto d = _r.template to_basic_type<double>(_var)) {
+      _builder->add_double(_key, *d);
+      return std::nullopt;
+    }
+
+    if constexpr (supports_string_views<R>) {
+      if (const auto s = _r.template to_basic_type<std::string_view>(_var)) {
+        return add_string(_key, *s, _builder);
+      }
+    }
+
+    if (const auto s = _r.template to_basic_type<std::string>(_var)) {
+      return add_string(_key, *s, _builder);
+    }
+
+    if (const auto obj = _r.to_object(_var)) {
+      std::vector<Error> errors;
+      const auto handle = _builder->begin_object(_key);
+      const auto err =
+          _r.read_object(ObjectReader(&_r, _builder, &errors), *obj);
+      _builder->end(handle);
+      if (err) {
+        return err;
+      }
+      if (errors.size() != 0) {
+        return to_single_error_message(errors);
+      }
+      return std::nullopt;
+    }
+
+    if (const auto arr = _r.to_array(_var)) {
+      const auto handle = _builder->begin_array(_key);
+      const auto err = _r.read_array(ArrayReader(&_r, _builder), *arr);
+      _builder->end(handle);
+      return err;
+    }
+
+    return Error(
+        "rfl::CompactGeneric: Could not determine the type of the value.");
+  }
+
+  static std::optional<Error> add_string(
+      const std::string_view _key, const std::string_view _str,
+      CompactGeneric::Builder* _builder) noexcept {
+    if (_str.size() > std::numeric_limits<uint32_t>::max()) {
+      return Error("rfl::CompactGeneric: Strings must be shorter than 4 GB.");
+    }
+    _builder->add_string(_key, _str);
+    return std::nullopt;
+  }
+
+  template <class P>
+  static void write_value(const W& _w, const CompactGeneric::Value& _v,
+                          const P& _parent) noexcept {
+    using Type = CompactGeneric::Type;
+    switch (_v.type()) {
+      case Type::boolean:
+        ParentType::add_value(_w, *_v.to_bool(), _parent);
+        break;
+
+      case Type::integer:
+        ParentType::add_value(_w, *_v.to_int(), _parent);
+        break;
+
+      case Type::floating_point:
+        ParentType::add_value(_w, *_v.to_double(), _parent);
+        break;
+
+      case Type::string:
+        ParentType::add_value(_w, *_v.to_string(), _parent);
+        break;
+
+      case Type::array: {
+        auto arr = ParentType::add_array(_w, _v.size(), _parent);
+        const auto new_parent = typename ParentType::Array{&arr};
+        const auto elements = _v.to_array().value();
+        for (const auto& e : elements) {
+          write_value(_w, e, new_parent);
+        }
+        _w.end_array(&arr);
+        break;
+      }
+
+      case Type::object: {
+        auto obj = ParentType::add_object(_w, _v.size(), _parent);
+        const auto members = _v.to_object().value();
+        for (const auto& m : members) {
+          const auto new_parent = typename ParentType::Object{m.key_, &obj};
+          write_value(_w, m.value_, new_parent);
+        }
+        _w.end_object(&obj);
+        break;
+      }
+
+      default:
+        ParentType::add_null(_w, _parent);
+        break;
+    }
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
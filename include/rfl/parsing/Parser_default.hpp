@@ -4,6 +4,8 @@
 #include <bit>
 #include <map>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "../Result.hpp"
@@ -28,6 +30,8 @@
 #include "call_destructors_where_necessary.hpp"
 #include "is_tagged_union_wrapper.hpp"
 #include "schema/Type.hpp"
+#include "supports_string_view_values.hpp"
+#include "supports_string_views.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -80,6 +84,12 @@ struct Parser {
               *_r.template to_basic_type<std::underlying_type_t<T>>(_var));
         } else {
           using StringConverter = internal::enums::StringConverter<T>;
+          if constexpr (supports_string_views<R>) {
+            const auto str = _r.template to_basic_type<std::string_view>(_var);
+            if (str) {
+              return StringConverter::string_to_enum(*str);
+            }
+          }
           return _r.template to_basic_type<std::string>(_var).and_then(
               StringConverter::string_to_enum);
         }
@@ -89,6 +99,43 @@ struct Parser {
     }
   }
 
+  /// Whether read(...) parses T field by field, using read_struct(...) or
+  /// read_struct_with_default(...).
+  static constexpr bool reads_struct_ = [] {
+    if constexpr (internal::has_read_reflector<T> ||
+                  R::template has_custom_constructor<T> ||
+                  internal::has_reflection_type_v<T>) {
+      return false;
+    } else {
+      return std::is_class_v<T> && std::is_aggregate_v<T>;
+    }
+  }();
+
+  /// Whether T can be constructed directly in the memory it is meant to
+  /// occupy using read_in_place(...). This is the case for all structs that
+  /// read(...) would parse using read_struct(...).
+  static constexpr bool reads_in_place_ =
+      reads_struct_ && !ProcessorsType::default_if_missing_;
+
+  /// Constructs T in the uninitialized memory _ptr points to. Unlike
+  /// read(...), this writes the fields straight into their final location,
+  /// so structs nested inside other structs or arrays do not have to be moved
+  /// at every level. If an error occurs, the fields that have already been
+  /// constructed are destroyed again and _ptr remains uninitialized.
+  static std::optional<Error> read_in_place(const R& _r,
+                                            const InputVarType& _var,
+                                            T* _ptr) noexcept {
+    static_assert(reads_in_place_, "T cannot be read in place.");
+    auto view = ProcessorsType::template process<T>(to_view(*_ptr));
+    using ViewType = std::remove_cvref_t<decltype(view)>;
+    const auto [set, err] =
+        Parser<R, W, ViewType, ProcessorsType>::read_view(_r, _var, &view);
+    if (err) [[unlikely]] {
+      call_destructors_where_necessary(set, &view);
+    }
+    return err;
+  }
+
   template <class P>
   static void write(const W& _w, const T& _var, const P& _parent) noexcept {
     if constexpr (internal::has_write_reflector<T>) {
@@ -115,8 +162,15 @@ struct Parser {
         ParentType::add_value(_w, val, _parent);
       } else {
         using StringConverter = internal::enums::StringConverter<T>;
-        const auto str = StringConverter::enum_to_string(_var);
-        ParentType::add_value(_w, str, _parent);
+        if constexpr (supports_string_view_values<W>) {
+          StringConverter::with_string_view(
+              _var, [&](const std::string_view _str) {
+                ParentType::add_value(_w, _str, _parent);
+              });
+        } else {
+          const auto str = StringConverter::enum_to_string(_var);
+          ParentType::add_value(_w, str, _parent);
+        }
       }
     } else {
       ParentType::add_value(_w, _var, _parent);
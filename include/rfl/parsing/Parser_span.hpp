@@ -0,0 +1,84 @@
+#ifndef RFL_PARSING_PARSER_SPAN_HPP_
+#define RFL_PARSING_PARSER_SPAN_HPP_
+
+#include <map>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "../Ref.hpp"
+#include "../Result.hpp"
+#include "../always_false.hpp"
+#include "Parent.hpp"
+#include "Parser_base.hpp"
+#include "schema/Type.hpp"
+#include "supports_write_numbers.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// std::span<const T> can only be read, if the reader is able to view the
+/// underlying array of numbers in place, which requires the format to store
+/// them packed.
+template <class R, class W, class T, class ProcessorsType>
+requires AreReaderAndWriter<R, W, std::span<const T>>
+struct Parser<R, W, std::span<const T>, ProcessorsType> {
+  using InputArrayType = typename R::InputArrayType;
+  using InputVarType = typename R::InputVarType;
+
+  using ParentType = Parent<W>;
+
+  static Result<std::span<const T>> read(const R& _r,
+                                         const InputVarType& _var) noexcept {
+    if constexpr (!ProcessorsType::borrow_from_document_) {
+      static_assert(always_false_v<R>,
+                    "Reading into std::span is dangerous and "
+                    "therefore unsupported by read(...). "
+                    "Please consider using std::vector instead or use "
+                    "read_borrowed(...), which keeps the underlying "
+                    "document alive for as long as the object.");
+      return Error("Unsupported.");
+    } else if constexpr (!requires(R r, InputArrayType arr) {
+                           r.template view_numbers<T>(arr);
+                         }) {
+      static_assert(always_false_v<R>,
+                    "This format does not support reading into std::span. "
+                    "Please use std::vector instead.");
+      return Error("Unsupported.");
+    } else {
+      const auto view = [&](const InputArrayType& _arr) {
+        return _r.template view_numbers<T>(_arr);
+      };
+      return _r.to_array(_var).and_then(view);
+    }
+  }
+
+  template <class P>
+  static void write(const W& _w, const std::span<const T>& _span,
+                    const P& _parent) noexcept {
+    if constexpr (supports_write_numbers<W, T>) {
+      ParentType::add_numbers(_w, _span, _parent);
+    } else {
+      auto arr = ParentType::add_array(_w, _span.size(), _parent);
+      const auto new_parent = typename ParentType::Array{&arr};
+      for (const auto& e : _span) {
+        Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::write(
+            _w, e, new_parent);
+      }
+      _w.end_array(&arr);
+    }
+  }
+
+  static schema::Type to_schema(
+      std::map<std::string, schema::Type>* _definitions) {
+    return schema::Type{schema::Type::TypedArray{
+        .type_ = Ref<schema::Type>::make(
+            Parser<R, W, std::remove_cvref_t<T>, ProcessorsType>::to_schema(
+                _definitions))}};
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
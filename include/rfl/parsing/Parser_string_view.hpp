@@ -19,13 +19,19 @@ requires AreReaderAndWriter<R, W, std::string_view>
 struct Parser<R, W, std::string_view, ProcessorsType> {
   using InputVarType = typename R::InputVarType;
 
-  static Result<std::string_view> read(const R&,
-                                       const InputVarType&) noexcept {
-    static_assert(always_false_v<R>,
-                  "Reading into std::string_view is dangerous and "
-                  "therefore unsupported. "
-                  "Please consider using std::string instead.");
-    return Error("Unsupported.");
+  static Result<std::string_view> read(const R& _r,
+                                       const InputVarType& _var) noexcept {
+    if constexpr (!ProcessorsType::borrow_from_document_) {
+      static_assert(always_false_v<R>,
+                    "Reading into std::string_view is dangerous and "
+                    "therefore unsupported by read(...). "
+                    "Please consider using std::string instead or use "
+                    "read_borrowed(...), which keeps the underlying "
+                    "document alive for as long as the object.");
+      return Error("Unsupported.");
+    } else {
+      return _r.template to_basic_type<std::string_view>(_var);
+    }
   }
 
   template <class P>
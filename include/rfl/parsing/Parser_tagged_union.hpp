@@ -1,19 +1,26 @@
 #ifndef RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 #define RFL_PARSING_PARSER_TAGGED_UNION_HPP_
 
+#include <array>
 #include <map>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <variant>
 
 #include "../Result.hpp"
 #include "../TaggedUnion.hpp"
 #include "../always_false.hpp"
+#include "../internal/StringHashTable.hpp"
 #include "../internal/strings/join.hpp"
 #include "../named_tuple_t.hpp"
 #include "Parser_base.hpp"
 #include "TaggedUnionWrapper.hpp"
 #include "is_tagged_union_wrapper.hpp"
 #include "schema/Type.hpp"
+#include "supports_first_field.hpp"
+#include "supports_string_views.hpp"
 #include "tagged_union_wrapper_no_ptr.hpp"
 
 namespace rfl {
@@ -39,15 +46,12 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
 
   static ResultType read(const R& _r, const InputVarType& _var) noexcept {
     const auto get_disc =
-        [&_r](InputObjectOrArrayType _obj_or_arr) -> Result<std::string> {
+        [&_r](InputObjectOrArrayType _obj_or_arr) -> Result<InputVarType> {
       return get_discriminator(_r, _obj_or_arr);
     };
 
-    const auto to_result =
-        [&_r, _var](const std::string& _disc_value) -> ResultType {
-      return find_matching_alternative(
-          _r, _disc_value, _var,
-          std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
+    const auto to_result = [&_r, _var](const InputVarType& _disc) {
+      return read_discriminator(_r, _disc, _var);
     };
 
     if constexpr (no_field_names_) {
@@ -76,111 +80,170 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>,
   }
 
  private:
+  using PossibleTags =
+      possible_tags_t<TaggedUnion<_discriminator, AlternativeTypes...>>;
+
+  static_assert(!PossibleTags::has_duplicates(),
+                "Duplicate tags are not allowed inside tagged unions.");
+
+  template <int _i>
+  using alternative_t = std::remove_cvref_t<
+      std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
+
+  template <int _i>
+  using alternative_tag_t = internal::tag_t<_discriminator, alternative_t<_i>>;
+
+  static constexpr size_t num_tags_ = PossibleTags::size();
+
+  /// The tags of all alternatives and the index of the alternative each of
+  /// them belongs to.
+  struct Tags {
+    std::array<std::string_view, num_tags_> names_;
+    std::array<int, num_tags_> alternatives_;
+  };
+
   template <int... _is>
-  static ResultType find_matching_alternative(
-      const R& _r, const std::string& _disc_value, const InputVarType& _var,
-      std::integer_sequence<int, _is...>) noexcept {
-    using PossibleTags =
-        possible_tags_t<TaggedUnion<_discriminator, AlternativeTypes...>>;
-    static_assert(!PossibleTags::has_duplicates(),
-                  "Duplicate tags are not allowed inside tagged unions.");
-    ResultType res = Error("");
-    bool match_found = false;
-    (set_if_disc_value_matches<_is>(_r, _disc_value, _var, &res, &match_found),
+  static constexpr Tags make_tags(std::integer_sequence<int, _is...>) {
+    Tags tags{};
+    size_t n = 0;
+    const auto add =
+        [&]<int _i, int... _js>(std::integer_sequence<int, _js...>) {
+          ((tags.names_[n] =
+                alternative_tag_t<_i>::template string_view_of<_js>(),
+            tags.alternatives_[n++] = _i),
+           ...);
+        };
+    (add.template operator()<_is>(
+         std::make_integer_sequence<int, alternative_tag_t<_is>::size()>()),
      ...);
-    if (match_found) [[likely]] {
-      return res;
-    } else {
-      const auto names = PossibleTags::names();
-      std::stringstream stream;
-      stream << "Could not parse tagged union, could not match "
-             << _discriminator.str() << " '" << _disc_value
-             << "'. The following tags are allowed: "
-             << internal::strings::join(", ", names);
-      return Error(stream.str());
-    }
+    return tags;
   }
 
+  static constexpr Tags tags_ = make_tags(
+      std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
+
+  static constexpr auto tag_table_ =
+      internal::StringHashTable<num_tags_>(tags_.names_);
+
   template <int _i>
-  static void set_if_disc_value_matches(const R& _r,
-                                        const std::string& _disc_value,
-                                        const InputVarType& _var,
-                                        ResultType* _res,
-                                        bool* _match_found) noexcept {
-    using AlternativeType = std::remove_cvref_t<
-        std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
-
-    if (!*_match_found && contains_disc_value<AlternativeType>(_disc_value)) {
-      const auto get_fields = [](auto&& _val) -> AlternativeType {
-        if constexpr (is_tagged_union_wrapper_v<decltype(_val)>) {
-          return std::move(_val.fields());
-        } else {
-          return std::move(_val);
-        }
-      };
+  static ResultType read_alternative(const R& _r,
+                                     const std::string_view _disc_value,
+                                     const InputVarType& _var) noexcept {
+    using AlternativeType = alternative_t<_i>;
+
+    const auto get_fields = [](auto&& _val) -> AlternativeType {
+      if constexpr (is_tagged_union_wrapper_v<decltype(_val)>) {
+        return std::move(_val.fields());
+      } else {
+        return std::move(_val);
+      }
+    };
 
-      const auto to_tagged_union = [](auto&& _val) {
-        return TaggedUnion<_discriminator, AlternativeTypes...>(
-            std::move(_val));
-      };
+    const auto to_tagged_union = [](auto&& _val) {
+      return TaggedUnion<_discriminator, AlternativeTypes...>(std::move(_val));
+    };
 
-      const auto embellish_error = [&](Error&& _e) {
+    const auto embellish_error = [&](Error&& _e) {
+      if constexpr (ProcessorsType::fail_fast_) {
+        return std::move(_e);
+      } else {
         std::stringstream stream;
         stream << "Could not parse tagged union with "
                   "discrimininator "
                << _discriminator.str() << " '" << _disc_value
                << "': " << _e.what();
         return Error(stream.str());
-      };
-
-      if constexpr (no_field_names_) {
-        using T = tagged_union_wrapper_no_ptr_t<std::invoke_result_t<
-            decltype(wrap_if_necessary<AlternativeType>), AlternativeType>>;
-        *_res = Parser<R, W, T, ProcessorsType>::read(_r, _var)
-                    .transform(get_fields)
-                    .transform(to_tagged_union)
-                    .or_else(embellish_error);
-      } else {
-        *_res = Parser<R, W, AlternativeType, ProcessorsType>::read(_r, _var)
-                    .transform(to_tagged_union)
-                    .or_else(embellish_error);
       }
+    };
 
-      *_match_found = true;
+    if constexpr (no_field_names_) {
+      using T = tagged_union_wrapper_no_ptr_t<std::invoke_result_t<
+          decltype(wrap_if_necessary<AlternativeType>), AlternativeType>>;
+      return Parser<R, W, T, ProcessorsType>::read(_r, _var)
+          .transform(get_fields)
+          .transform(to_tagged_union)
+          .or_else(embellish_error);
+    } else {
+      return Parser<R, W, AlternativeType, ProcessorsType>::read(_r, _var)
+          .transform(to_tagged_union)
+          .or_else(embellish_error);
     }
   }
 
-  /// Retrieves the discriminator from an object
-  static Result<std::string> get_discriminator(
-      const R& _r, const InputObjectOrArrayType& _obj_or_arr) noexcept {
-    const auto to_type = [&_r](auto _var) {
-      return _r.template to_basic_type<std::string>(_var);
-    };
+  using AlternativeReader = ResultType (*)(const R&, std::string_view,
+                                           const InputVarType&);
+
+  /// The function that reads the alternative signified by each tag.
+  template <int... _ks>
+  static constexpr auto make_alternative_readers(
+      std::integer_sequence<int, _ks...>) {
+    return std::array<AlternativeReader, num_tags_>{
+        &read_alternative<tags_.alternatives_[_ks]>...};
+  }
+
+  static constexpr auto alternative_readers_ = make_alternative_readers(
+      std::make_integer_sequence<int, static_cast<int>(num_tags_)>());
 
-    const auto embellish_error = [](const auto&) {
+  static ResultType find_matching_alternative(
+      const R& _r, const std::string_view _disc_value,
+      const InputVarType& _var) noexcept {
+    const auto ix = tag_table_.find(_disc_value);
+    if (ix != -1) [[likely]] {
+      return alternative_readers_[ix](_r, _disc_value, _var);
+    } else {
+      const auto names = PossibleTags::names();
       std::stringstream stream;
-      stream << "Could not parse tagged union: Could not find field '"
-             << _discriminator.str() << "' or type of field was not a string.";
+      stream << "Could not parse tagged union, could not match "
+             << _discriminator.str() << " '" << _disc_value
+             << "'. The following tags are allowed: "
+             << internal::strings::join(", ", names);
       return Error(stream.str());
+    }
+  }
+
+  /// Reads the value of the discriminator and parses the matching
+  /// alternative. The value is not copied, if the reader supports that.
+  static ResultType read_discriminator(const R& _r, const InputVarType& _disc,
+                                       const InputVarType& _var) noexcept {
+    if constexpr (supports_string_views<R>) {
+      const auto view = _r.template to_basic_type<std::string_view>(_disc);
+      if (view) {
+        return find_matching_alternative(_r, *view, _var);
+      }
+    }
+    const auto to_result = [&](const std::string& _disc_value) -> ResultType {
+      return find_matching_alternative(_r, _disc_value, _var);
     };
+    return _r.template to_basic_type<std::string>(_disc)
+        .or_else(discriminator_error)
+        .and_then(to_result);
+  }
 
+  /// Retrieves the discriminator from an object. If the reader supports it
+  /// and the discriminator is the first field, as it is when rfl has written
+  /// the object, this does not require a search.
+  static Result<InputVarType> get_discriminator(
+      const R& _r, const InputObjectOrArrayType& _obj_or_arr) noexcept {
     if constexpr (no_field_names_) {
       return _r.get_field_from_array(0, _obj_or_arr)
-          .and_then(to_type)
-          .or_else(embellish_error);
+          .or_else(discriminator_error);
     } else {
+      if constexpr (supports_first_field<R>) {
+        const auto first = _r.get_first_field(_obj_or_arr);
+        if (first && first->first == _discriminator.string_view()) {
+          return first->second;
+        }
+      }
       return _r.get_field_from_object(_discriminator.str(), _obj_or_arr)
-          .and_then(to_type)
-          .or_else(embellish_error);
+          .or_else(discriminator_error);
     }
   }
 
-  /// Determines whether the discriminating literal contains the value
-  /// retrieved from the object.
-  template <class T>
-  static inline bool contains_disc_value(
-      const std::string& _disc_value) noexcept {
-    return internal::tag_t<_discriminator, T>::contains(_disc_value);
+  static Error discriminator_error(const Error&) noexcept {
+    std::stringstream stream;
+    stream << "Could not parse tagged union: Could not find field '"
+           << _discriminator.str() << "' or type of field was not a string.";
+    return Error(stream.str());
   }
 
   /// Writes a wrapped version of the original object, which contains the tag.
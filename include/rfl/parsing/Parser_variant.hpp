@@ -1,6 +1,7 @@
 #ifndef RFL_PARSING_PARSER_VARIANT_HPP_
 #define RFL_PARSING_PARSER_VARIANT_HPP_
 
+#include <array>
 #include <map>
 #include <optional>
 #include <type_traits>
@@ -14,6 +15,7 @@
 #include "FieldVariantParser.hpp"
 #include "Parser_base.hpp"
 #include "VariantAlternativeWrapper.hpp"
+#include "VariantShapes.hpp"
 #include "schema/Type.hpp"
 #include "to_single_error_message.hpp"
 
@@ -55,14 +57,37 @@ class Parser<R, W, std::variant<AlternativeTypes...>, ProcessorsType> {
           });
 
     } else {
+      using ShapesType =
+          VariantShapes<R, W, ProcessorsType, AlternativeTypes...>;
       std::optional<std::variant<AlternativeTypes...>> result;
       std::vector<Error> errors;
+      auto candidates = std::array<bool, sizeof...(AlternativeTypes)>();
+      if constexpr (ShapesType::enabled_) {
+        candidates = ShapesType::candidates(_r, _var);
+      } else {
+        candidates.fill(true);
+      }
       read_variant(
-          _r, _var, &result, &errors,
+          _r, _var, candidates, &result, &errors,
           std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
       if (result) {
         return std::move(*result);
+      } else if constexpr (ProcessorsType::fail_fast_) {
+        return Error("Could not parse the variant. None of the alternatives "
+                     "matched.");
       } else {
+        if constexpr (ShapesType::enabled_) {
+          // The alternatives that were ruled out have not been tried, so we
+          // need to try all of them to get the full error message.
+          errors.clear();
+          candidates.fill(true);
+          read_variant(
+              _r, _var, candidates, &result, &errors,
+              std::make_integer_sequence<int, sizeof...(AlternativeTypes)>());
+          if (result) {
+            return std::move(*result);
+          }
+        }
         return Error(
             to_single_error_message(errors,
                                     "Could not parse the variant. Each of the "
@@ -147,16 +172,16 @@ class Parser<R, W, std::variant<AlternativeTypes...>, ProcessorsType> {
 
   template <int _i>
   static void read_one_alternative(
-      const R& _r, const InputVarType& _var,
+      const R& _r, const InputVarType& _var, const bool _candidate,
       std::optional<std::variant<AlternativeTypes...>>* _result,
       std::vector<Error>* _errors) noexcept {
-    if (!*_result) {
+    if (!*_result && _candidate) {
       using AltType =
           std::remove_cvref_t<internal::nth_element_t<_i, AlternativeTypes...>>;
       auto res = Parser<R, W, AltType, ProcessorsType>::read(_r, _var);
       if (res) {
         *_result = std::move(*res);
-      } else {
+      } else if constexpr (!ProcessorsType::fail_fast_) {
         _errors->emplace_back(*res.error());
       }
     }
@@ -165,10 +190,12 @@ class Parser<R, W, std::variant<AlternativeTypes...>, ProcessorsType> {
   template <int... _is>
   static void read_variant(
       const R& _r, const InputVarType& _var,
+      const std::array<bool, sizeof...(AlternativeTypes)>& _candidates,
       std::optional<std::variant<AlternativeTypes...>>* _result,
       std::vector<Error>* _errors,
       std::integer_sequence<int, _is...>) noexcept {
-    (read_one_alternative<_is>(_r, _var, _result, _errors), ...);
+    (read_one_alternative<_is>(_r, _var, _candidates[_is], _result, _errors),
+     ...);
   }
 };
 
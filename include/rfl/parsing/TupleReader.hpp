@@ -9,6 +9,7 @@
 #include "../Result.hpp"
 #include "../Tuple.hpp"
 #include "../internal/is_array.hpp"
+#include "reads_in_place.hpp"
 
 namespace rfl::parsing {
 
@@ -70,14 +71,26 @@ class TupleReader {
         using CurrentType =
             std::remove_cvref_t<rfl::tuple_element_t<_i, TupleType>>;
 
-        auto res = Parser<R, W, CurrentType, ProcessorsType>::read(*r_, _var);
-
-        if (res) {
-          move_to(&(rfl::get<_i>(*tuple_)), &(*res));
-          ++num_set_;
+        using ParserType = Parser<R, W, CurrentType, ProcessorsType>;
+
+        if constexpr (reads_in_place<ParserType>) {
+          const auto err = ParserType::read_in_place(
+              *r_, _var, const_cast<CurrentType*>(&(rfl::get<_i>(*tuple_))));
+          if (err) {
+            *_err = Error("Failed to parse field " + std::to_string(_i) +
+                          ": " + err->what());
+          } else {
+            ++num_set_;
+          }
         } else {
-          *_err = Error("Failed to parse field " + std::to_string(_i) + ": " +
-                        res.error()->what());
+          auto res = ParserType::read(*r_, _var);
+          if (res) {
+            move_to(&(rfl::get<_i>(*tuple_)), &(*res));
+            ++num_set_;
+          } else {
+            *_err = Error("Failed to parse field " + std::to_string(_i) +
+                          ": " + res.error()->what());
+          }
         }
         return;
       }
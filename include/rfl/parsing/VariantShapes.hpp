@@ -0,0 +1,261 @@
+#ifndef RFL_PARSING_VARIANTSHAPES_HPP_
+#define RFL_PARSING_VARIANTSHAPES_HPP_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../Tuple.hpp"
+#include "../internal/StringHashTable.hpp"
+#include "../internal/is_extra_fields.hpp"
+#include "../internal/is_flatten_field.hpp"
+#include "../internal/is_literal.hpp"
+#include "../internal/is_skip.hpp"
+#include "../internal/processed_t.hpp"
+#include "Parser_base.hpp"
+#include "is_required.hpp"
+
+namespace rfl::parsing {
+
+/// Untagged variants are parsed by trying one alternative after the other.
+/// When several of the alternatives are structs, that means a full parse for
+/// each struct that comes before the right one. VariantShapes determines at
+/// compile time which field names each struct requires and which of its
+/// fields are literals. At runtime, it goes over the keys of the input object
+/// once and rules out all alternatives that cannot possibly match, so that
+/// only the remaining ones have to be tried.
+///
+/// The check is conservative: It only rules out alternatives that would
+/// certainly fail to parse, so the result of parsing the variant does not
+/// change.
+template <class R, class W, class ProcessorsType, class... AlternativeTypes>
+class VariantShapes {
+  using InputObjectType = typename R::InputObjectType;
+  using InputVarType = typename R::InputVarType;
+
+  static constexpr size_t num_alternatives_ = sizeof...(AlternativeTypes);
+
+  /// Whether T is read by Parser_default as a struct, which means that it
+  /// can only be parsed from an object containing its required fields.
+  /// Structs for which Parser has been specialized are not, because their
+  /// Parser may expect entirely different fields.
+  template <class T>
+  static constexpr bool is_struct() {
+    using U = std::remove_cvref_t<T>;
+    return requires {
+      requires Parser<R, W, U, ProcessorsType>::reads_struct_;
+    };
+  }
+
+  struct FieldShape {
+    std::string_view name_;
+    bool required_;
+    bool (*matches_literal_)(const std::string&);
+  };
+
+  template <class FieldType>
+  static constexpr FieldShape make_field_shape() {
+    using T =
+        std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
+    constexpr bool ignored =
+        internal::is_extra_fields_v<T> || internal::is_flatten_field_v<T> ||
+        internal::is_skip_v<T>;
+    constexpr bool required = !ignored &&
+                              !ProcessorsType::default_if_missing_ &&
+                              is_required<T, true>();
+    if constexpr (!ignored && internal::is_literal_v<T>) {
+      return FieldShape{FieldType::name(), required, &T::contains};
+    } else {
+      return FieldShape{FieldType::name(), required, nullptr};
+    }
+  }
+
+  template <class Fields, int... _is>
+  static constexpr auto make_field_shapes(std::integer_sequence<int, _is...>) {
+    return std::array<FieldShape, sizeof...(_is)>{
+        make_field_shape<tuple_element_t<_is, Fields>>()...};
+  }
+
+  /// The shapes of the fields of T, if T is a struct.
+  template <class T>
+  static constexpr auto field_shapes() {
+    if constexpr (is_struct<T>()) {
+      using NamedTupleType =
+          internal::processed_t<std::remove_cvref_t<T>, ProcessorsType>;
+      using Fields = typename NamedTupleType::Fields;
+      return make_field_shapes<Fields>(
+          std::make_integer_sequence<int, NamedTupleType::size()>());
+    } else {
+      return std::array<FieldShape, 0>{};
+    }
+  }
+
+  /// Whether the field influences which alternatives can match.
+  static constexpr bool is_relevant(const FieldShape& _f) {
+    return _f.required_ || _f.matches_literal_;
+  }
+
+  /// The shapes of the fields of all alternatives.
+  static constexpr auto shapes_ =
+      std::make_tuple(field_shapes<AlternativeTypes>()...);
+
+  static constexpr size_t num_structs_ =
+      (0 + ... + (is_struct<AlternativeTypes>() ? 1 : 0));
+
+  template <int... _is>
+  static constexpr size_t count_names(std::integer_sequence<int, _is...>) {
+    return (0 + ... + std::get<_is>(shapes_).size());
+  }
+
+  static constexpr size_t max_names_ =
+      count_names(std::make_integer_sequence<int, num_alternatives_>());
+
+  /// All relevant field names, without duplicates. Returns the names and
+  /// their number.
+  template <int... _is>
+  static constexpr auto collect_names(std::integer_sequence<int, _is...>) {
+    std::array<std::string_view, max_names_> names{};
+    size_t num_names = 0;
+    const auto add = [&](const auto& _shapes) {
+      for (const auto& f : _shapes) {
+        if (!is_relevant(f)) {
+          continue;
+        }
+        bool found = false;
+        for (size_t i = 0; i < num_names; ++i) {
+          found = found || names[i] == f.name_;
+        }
+        if (!found) {
+          names[num_names++] = f.name_;
+        }
+      }
+    };
+    (add(std::get<_is>(shapes_)), ...);
+    return std::make_pair(names, num_names);
+  }
+
+  static constexpr auto collected_names_ =
+      collect_names(std::make_integer_sequence<int, num_alternatives_>());
+
+  static constexpr size_t num_names_ = collected_names_.second;
+
+  static constexpr auto make_names() {
+    std::array<std::string_view, num_names_> names{};
+    for (size_t i = 0; i < num_names_; ++i) {
+      names[i] = collected_names_.first[i];
+    }
+    return names;
+  }
+
+  static constexpr auto names_ =
+      internal::StringHashTable<num_names_>(make_names());
+
+  /// Whether any of the alternatives expects a literal in the field.
+  static constexpr auto make_is_literal() {
+    std::array<bool, num_names_> is_literal{};
+    const auto add = [&](const auto& _shapes) {
+      for (const auto& f : _shapes) {
+        if (f.matches_literal_) {
+          is_literal[names_.find(f.name_)] = true;
+        }
+      }
+    };
+    [&]<int... _is>(std::integer_sequence<int, _is...>) {
+      (add(std::get<_is>(shapes_)), ...);
+    }(std::make_integer_sequence<int, num_alternatives_>());
+    return is_literal;
+  }
+
+  static constexpr auto is_literal_ = make_is_literal();
+
+  struct Keys {
+    std::array<bool, num_names_> found_{};
+    std::array<std::optional<std::string>, num_names_> literals_;
+  };
+
+  /// Records the relevant keys of the input object.
+  class KeyReader {
+   public:
+    KeyReader(const R* _r, Keys* _keys) : r_(_r), keys_(_keys) {}
+
+    /// Makes sure that this sees the same fields as the ViewReader of the
+    /// alternatives, including those the reader adds, like xml_content.
+    static constexpr bool reads_struct_fields_ = true;
+
+    void read(const std::string_view& _name, const InputVarType& _var) const {
+      const auto ix = names_.find(_name);
+      if (ix == -1) {
+        return;
+      }
+      keys_->found_[ix] = true;
+      if (is_literal_[ix]) {
+        auto str = r_->template to_basic_type<std::string>(_var);
+        if (str) {
+          keys_->literals_[ix] = std::move(*str);
+        }
+      }
+    }
+
+   private:
+    const R* r_;
+    Keys* keys_;
+  };
+
+  template <int _i>
+  static bool can_match(const Keys& _keys) noexcept {
+    for (const auto& f : std::get<_i>(shapes_)) {
+      if (!is_relevant(f)) {
+        continue;
+      }
+      const auto ix = names_.find(f.name_);
+      if (!_keys.found_[ix]) {
+        if (f.required_) {
+          return false;
+        }
+        continue;
+      }
+      if (f.matches_literal_ &&
+          (!_keys.literals_[ix] || !f.matches_literal_(*_keys.literals_[ix]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ public:
+  /// Pre-dispatch only pays off if more than one alternative is a struct.
+  static constexpr bool enabled_ =
+      !ProcessorsType::no_field_names_ && num_structs_ > 1;
+
+  /// Returns false for all alternatives that cannot be parsed from _var.
+  static std::array<bool, num_alternatives_> candidates(
+      const R& _r, const InputVarType& _var) noexcept {
+    std::array<bool, num_alternatives_> candidates;
+    candidates.fill(true);
+    auto obj = _r.to_object(_var);
+    if (!obj) {
+      [&]<int... _is>(std::integer_sequence<int, _is...>) {
+        ((candidates[_is] = !is_struct<AlternativeTypes>()), ...);
+      }(std::make_integer_sequence<int, num_alternatives_>());
+      return candidates;
+    }
+    Keys keys;
+    const auto err = _r.read_object(KeyReader(&_r, &keys), *obj);
+    if (err) {
+      return candidates;
+    }
+    [&]<int... _is>(std::integer_sequence<int, _is...>) {
+      ((candidates[_is] = can_match<_is>(keys)), ...);
+    }(std::make_integer_sequence<int, num_alternatives_>());
+    return candidates;
+  }
+};
+
+}  // namespace rfl::parsing
+
+#endif
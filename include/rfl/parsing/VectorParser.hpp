@@ -3,6 +3,7 @@
 
 #include <iterator>
 #include <map>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -18,6 +19,9 @@
 #include "is_map_like_not_multimap.hpp"
 #include "is_set_like.hpp"
 #include "schema/Type.hpp"
+#include "supports_read_numbers.hpp"
+#include "supports_write_numbers.hpp"
+#include "supports_size_hint.hpp"
 
 namespace rfl {
 namespace parsing {
@@ -53,6 +57,16 @@ struct VectorParser {
     } else {
       const auto parse = [&](const InputArrayType& _arr) -> Result<VecType> {
         VecType vec;
+        if constexpr (read_numbers_in_bulk()) {
+          vec.resize(_r.size_hint(_arr));
+          if (!vec.empty() &&
+              _r.read_numbers(_arr, std::span<T>(vec)) == vec.size()) {
+            return vec;
+          }
+          // Take the slow path to produce the appropriate error message.
+          vec.clear();
+        }
+        reserve_from_size_hint(_r, _arr, &vec);
         auto vector_reader =
             VectorReader<R, W, VecType, ProcessorsType>(&_r, &vec);
         const auto err = _r.read_array(vector_reader, _arr);
@@ -70,6 +84,9 @@ struct VectorParser {
                     const P& _parent) noexcept {
     if constexpr (treat_as_map()) {
       MapParser<R, W, VecType, ProcessorsType>::write(_w, _vec, _parent);
+    } else if constexpr (std::is_same_v<VecType, std::vector<T>> &&
+                         supports_write_numbers<W, T>) {
+      ParentType::add_numbers(_w, std::span<const T>(_vec), _parent);
     } else {
       auto arr = ParentType::add_array(
           _w, std::distance(_vec.begin(), _vec.end()), _parent);
@@ -92,6 +109,11 @@ struct VectorParser {
   }
 
  private:
+  static constexpr bool read_numbers_in_bulk() {
+    return std::is_same_v<VecType, std::vector<T>> &&
+           supports_read_numbers<R, T>;
+  }
+
   static constexpr bool treat_as_map() {
     if constexpr (is_map_like_not_multimap<VecType>()) {
       if constexpr (internal::has_reflection_type_v<typename T::first_type>) {
@@ -10,8 +10,11 @@
 
 #include "../Result.hpp"
 #include "../Tuple.hpp"
+#include "../internal/StringHashTable.hpp"
 #include "../internal/is_array.hpp"
 #include "Parser_base.hpp"
+#include "add_field_to_error.hpp"
+#include "reads_in_place.hpp"
 
 namespace rfl::parsing {
 
@@ -24,39 +27,90 @@ class ViewReader {
  public:
   ViewReader(const R* _r, ViewType* _view, std::array<bool, size_>* _found,
              std::array<bool, size_>* _set, std::vector<Error>* _errors)
-      : r_(_r), view_(_view), found_(_found), set_(_set), errors_(_errors) {}
+      : next_(0),
+        r_(_r),
+        view_(_view),
+        found_(_found),
+        set_(_set),
+        errors_(_errors) {}
 
   ~ViewReader() = default;
 
+  /// Signals to the readers that this assigns the fields of a struct.
+  static constexpr bool reads_struct_fields_ = true;
+
   /// Assigns the parsed version of _var to the field signified by _name, if
   /// such a field exists in the underlying view.
   void read(const std::string_view& _name, const InputVarType& _var) const {
-    assign_to_matching_field(*r_, _name, _var, view_, errors_, found_, set_,
-                             std::make_integer_sequence<int, size_>());
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!errors_->empty()) {
+        return;
+      }
+    }
+    const auto ix = find_index(_name);
+    if (ix != -1 && !(*found_)[ix]) {
+      (*found_)[ix] = true;
+      assign_field_functions_[ix](*r_, _var, view_, errors_, set_);
+      return;
+    }
+    if constexpr (ViewType::pos_extra_fields() != -1) {
+      constexpr int pos = ViewType::pos_extra_fields();
+      assign_to_extra_fields<pos>(*r_, _name, _var, view_, errors_, found_,
+                                  set_);
+    } else if constexpr (ProcessorsType::no_extra_fields_) {
+      std::stringstream stream;
+      stream << "Value named '" << _name
+             << "' not used. Remove the rfl::NoExtraFields processor or add "
+                "rfl::ExtraFields to avoid this error message.";
+      errors_->emplace_back(Error(stream.str()));
+    }
   }
 
  private:
+  /// Returns the index of the field signified by _name or -1, if there is no
+  /// such field.
+  int find_index(const std::string_view& _name) const {
+    if constexpr (ProcessorsType::assume_ordered_fields_) {
+      const auto ix = next_ < size_ && field_indices_[next_] == _name
+                          ? static_cast<int>(next_)
+                          : field_indices_.find(_name);
+      if (ix != -1) {
+        next_ = static_cast<size_t>(ix) + 1;
+      }
+      return ix;
+    } else {
+      return field_indices_.find(_name);
+    }
+  }
+
+  using AssignFieldFunction = void (*)(const R&, const InputVarType&,
+                                       ViewType*, std::vector<Error>*,
+                                       std::array<bool, size_>*);
+
   template <int i>
-  static void assign_if_field_matches(const R& _r,
-                                      const std::string_view& _current_name,
-                                      const auto& _var, auto* _view,
-                                      auto* _errors, auto* _found, auto* _set,
-                                      bool* _already_assigned) {
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors,
+                           std::array<bool, size_>* _set) {
     using FieldType = tuple_element_t<i, typename ViewType::Fields>;
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
+    using ParserType = Parser<R, W, T, ProcessorsType>;
     constexpr auto name = FieldType::name();
-    if (!(*_already_assigned) && !std::get<i>(*_found) &&
-        _current_name == name) {
-      std::get<i>(*_found) = true;
-      *_already_assigned = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if constexpr (std::is_pointer_v<OriginalType> &&
+                  reads_in_place<ParserType>) {
+      auto err = ParserType::read_in_place(
+          _r, _var, const_cast<T*>(rfl::get<i>(*_view)));
+      if (err) {
+        _errors->emplace_back(
+            add_field_to_error<ProcessorsType>(name, std::move(*err)));
+        return;
+      }
+    } else {
+      auto res = ParserType::read(_r, _var);
       if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error()->what();
-        _errors->emplace_back(Error(stream.str()));
+        _errors->emplace_back(
+            add_field_to_error<ProcessorsType>(name, std::move(*res.error())));
         return;
       }
       if constexpr (std::is_pointer_v<OriginalType>) {
@@ -64,8 +118,8 @@ class ViewReader {
       } else {
         rfl::get<i>(*_view) = std::move(*res);
       }
-      std::get<i>(*_set) = true;
     }
+    std::get<i>(*_set) = true;
   }
 
   template <int _pos>
@@ -85,42 +139,23 @@ class ViewReader {
     }
     auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
     if (!res) {
-      std::stringstream stream;
-      stream << "Failed to parse field '" << _current_name
-             << "': " << res.error()->what();
-      _errors->emplace_back(Error(stream.str()));
+      _errors->emplace_back(add_field_to_error<ProcessorsType>(
+          _current_name, std::move(*res.error())));
       return;
     }
     extra_fields->emplace(std::string(_current_name), std::move(*res));
   }
 
   template <int... is>
-  static void assign_to_matching_field(const R& _r,
-                                       const std::string_view& _current_name,
-                                       const auto& _var, auto* _view,
-                                       auto* _errors, auto* _found, auto* _set,
-                                       std::integer_sequence<int, is...>) {
-    bool already_assigned = false;
-
-    (assign_if_field_matches<is>(_r, _current_name, _var, _view, _errors,
-                                 _found, _set, &already_assigned),
-     ...);
+  static constexpr auto make_assign_field_functions(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldFunction, size_>{&assign_field<is>...};
+  }
 
-    if constexpr (ViewType::pos_extra_fields() != -1) {
-      constexpr int pos = ViewType::pos_extra_fields();
-      if (!already_assigned) {
-        assign_to_extra_fields<pos>(_r, _current_name, _var, _view, _errors,
-                                    _found, _set);
-      }
-    } else if constexpr (ProcessorsType::no_extra_fields_) {
-      if (!already_assigned) {
-        std::stringstream stream;
-        stream << "Value named '" << _current_name
-               << "' not used. Remove the rfl::NoExtraFields processor or add "
-                  "rfl::ExtraFields to avoid this error message.";
-        _errors->emplace_back(Error(stream.str()));
-      }
-    }
+  template <int... is>
+  static constexpr auto make_field_indices(std::integer_sequence<int, is...>) {
+    return internal::StringHashTable<size_>(std::array<std::string_view, size_>{
+        tuple_element_t<is, typename ViewType::Fields>::name()...});
   }
 
   template <class Target, class Source>
@@ -144,6 +179,18 @@ class ViewReader {
   }
 
  private:
+  /// Maps the field names to their index at compile time.
+  static constexpr auto field_indices_ =
+      make_field_indices(std::make_integer_sequence<int, size_>());
+
+  /// The functions used to assign the fields, indexed by the field index.
+  static constexpr auto assign_field_functions_ =
+      make_assign_field_functions(std::make_integer_sequence<int, size_>());
+
+  /// The index of the field we expect next, only used when
+  /// rfl::AssumeOrderedFields is passed.
+  mutable size_t next_;
+
   /// The underlying reader.
   const R* r_;
 
@@ -10,7 +10,9 @@
 
 #include "../Result.hpp"
 #include "../Tuple.hpp"
+#include "../internal/StringHashTable.hpp"
 #include "../internal/is_array.hpp"
+#include "add_field_to_error.hpp"
 
 namespace rfl::parsing {
 
@@ -23,43 +25,73 @@ class ViewReaderWithDefault {
  public:
   ViewReaderWithDefault(const R* _r, ViewType* _view,
                         std::vector<Error>* _errors)
-      : r_(_r), view_(_view), errors_(_errors) {}
+      : next_(0), r_(_r), view_(_view), errors_(_errors) {}
 
   ~ViewReaderWithDefault() = default;
 
   /// Assigns the parsed version of _var to the field signified by _name, if
   /// such a field exists in the underlying view.
   void read(const std::string_view& _name, const InputVarType& _var) const {
-    assign_to_matching_field(*r_, _name, _var, view_, errors_,
-                             std::make_integer_sequence<int, size_>());
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!errors_->empty()) {
+        return;
+      }
+    }
+    const auto ix = find_index(_name);
+    if (ix != -1) {
+      assign_field_functions_[ix](*r_, _var, view_, errors_);
+      return;
+    }
+    if constexpr (ViewType::pos_extra_fields() != -1) {
+      constexpr int pos = ViewType::pos_extra_fields();
+      assign_to_extra_fields<pos>(*r_, _name, _var, view_, errors_);
+    } else if constexpr (ProcessorsType::no_extra_fields_) {
+      std::stringstream stream;
+      stream << "Value named '" << std::string(_name)
+             << "' not used. Remove the rfl::NoExtraFields processor or add "
+                "rfl::ExtraFields to avoid this error message.";
+      errors_->emplace_back(Error(stream.str()));
+    }
   }
 
  private:
+  /// Returns the index of the field signified by _name or -1, if there is no
+  /// such field.
+  int find_index(const std::string_view& _name) const {
+    if constexpr (ProcessorsType::assume_ordered_fields_) {
+      const auto ix = next_ < size_ && field_indices_[next_] == _name
+                          ? static_cast<int>(next_)
+                          : field_indices_.find(_name);
+      if (ix != -1) {
+        next_ = static_cast<size_t>(ix) + 1;
+      }
+      return ix;
+    } else {
+      return field_indices_.find(_name);
+    }
+  }
+
+  using AssignFieldFunction = void (*)(const R&, const InputVarType&,
+                                       ViewType*, std::vector<Error>*);
+
   template <int i>
-  static void assign_if_field_matches(const R& _r,
-                                      const std::string_view& _current_name,
-                                      const auto& _var, auto* _view,
-                                      auto* _errors, bool* _already_assigned) {
+  static void assign_field(const R& _r, const InputVarType& _var,
+                           ViewType* _view, std::vector<Error>* _errors) {
     using FieldType = tuple_element_t<i, typename ViewType::Fields>;
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
     constexpr auto name = FieldType::name();
-    if (!(*_already_assigned) && _current_name == name) {
-      *_already_assigned = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
-      if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error()->what();
-        _errors->emplace_back(Error(stream.str()));
-        return;
-      }
-      if constexpr (std::is_pointer_v<OriginalType>) {
-        move_to(rfl::get<i>(*_view), &(*res));
-      } else {
-        rfl::get<i>(*_view) = std::move(*res);
-      }
+    auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
+    if (!res) {
+      _errors->emplace_back(
+          add_field_to_error<ProcessorsType>(name, std::move(*res.error())));
+      return;
+    }
+    if constexpr (std::is_pointer_v<OriginalType>) {
+      move_to(rfl::get<i>(*_view), &(*res));
+    } else {
+      rfl::get<i>(*_view) = std::move(*res);
     }
   }
 
@@ -75,41 +107,23 @@ class ViewReaderWithDefault {
         std::remove_pointer_t<typename ExtraFieldsType::Type>>;
     auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
     if (!res) {
-      std::stringstream stream;
-      stream << "Failed to parse field '" << _current_name
-             << "': " << res.error()->what();
-      _errors->emplace_back(Error(stream.str()));
+      _errors->emplace_back(add_field_to_error<ProcessorsType>(
+          _current_name, std::move(*res.error())));
       return;
     }
     extra_fields->emplace(std::string(_current_name), std::move(*res));
   }
 
   template <int... is>
-  static void assign_to_matching_field(const R& _r,
-                                       const std::string_view& _current_name,
-                                       const auto& _var, auto* _view,
-                                       auto* _errors,
-                                       std::integer_sequence<int, is...>) {
-    bool already_assigned = false;
-
-    (assign_if_field_matches<is>(_r, _current_name, _var, _view, _errors,
-                                 &already_assigned),
-     ...);
+  static constexpr auto make_assign_field_functions(
+      std::integer_sequence<int, is...>) {
+    return std::array<AssignFieldFunction, size_>{&assign_field<is>...};
+  }
 
-    if constexpr (ViewType::pos_extra_fields() != -1) {
-      constexpr int pos = ViewType::pos_extra_fields();
-      if (!already_assigned) {
-        assign_to_extra_fields<pos>(_r, _current_name, _var, _view, _errors);
-      }
-    } else if constexpr (ProcessorsType::no_extra_fields_) {
-      if (!already_assigned) {
-        std::stringstream stream;
-        stream << "Value named '" << std::string(_current_name)
-               << "' not used. Remove the rfl::NoExtraFields processor or add "
-                  "rfl::ExtraFields to avoid this error message.";
-        _errors->emplace_back(Error(stream.str()));
-      }
-    }
+  template <int... is>
+  static constexpr auto make_field_indices(std::integer_sequence<int, is...>) {
+    return internal::StringHashTable<size_>(std::array<std::string_view, size_>{
+        tuple_element_t<is, typename ViewType::Fields>::name()...});
   }
 
   template <class Target, class Source>
@@ -133,6 +147,18 @@ class ViewReaderWithDefault {
   }
 
  private:
+  /// Maps the field names to their index at compile time.
+  static constexpr auto field_indices_ =
+      make_field_indices(std::make_integer_sequence<int, size_>());
+
+  /// The functions used to assign the fields, indexed by the field index.
+  static constexpr auto assign_field_functions_ =
+      make_assign_field_functions(std::make_integer_sequence<int, size_>());
+
+  /// The index of the field we expect next, only used when
+  /// rfl::AssumeOrderedFields is passed.
+  mutable size_t next_;
+
   /// The underlying reader.
   const R* r_;
 
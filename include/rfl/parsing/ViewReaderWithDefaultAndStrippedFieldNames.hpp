@@ -11,6 +11,7 @@
 #include "../Result.hpp"
 #include "../Tuple.hpp"
 #include "../internal/is_array.hpp"
+#include "add_field_to_error.hpp"
 
 namespace rfl::parsing {
 
@@ -30,6 +31,11 @@ class ViewReaderWithDefaultAndStrippedFieldNames {
   /// Assigns the parsed version of _var to the field signified by i_, to be
   /// used when the field names are stripped.
   std::optional<Error> read(const InputVarType& _var) const {
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!errors_->empty()) {
+        return std::nullopt;
+      }
+    }
     if (i_ == size_) {
       std::stringstream stream;
       stream << "Expected a maximum of " << std::to_string(size_)
@@ -54,10 +60,8 @@ class ViewReaderWithDefaultAndStrippedFieldNames {
     if (_i == i) {
       auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
       if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error()->what();
-        _errors->emplace_back(Error(stream.str()));
+        _errors->emplace_back(
+            add_field_to_error<ProcessorsType>(name, std::move(*res.error())));
         return;
       }
       if constexpr (std::is_pointer_v<OriginalType>) {
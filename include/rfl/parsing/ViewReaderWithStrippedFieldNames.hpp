@@ -11,6 +11,8 @@
 #include "../Result.hpp"
 #include "../Tuple.hpp"
 #include "../internal/is_array.hpp"
+#include "add_field_to_error.hpp"
+#include "reads_in_place.hpp"
 
 namespace rfl::parsing {
 
@@ -37,6 +39,11 @@ class ViewReaderWithStrippedFieldNames {
   /// Assigns the parsed version of _var to the field signified by i_, to be
   /// used when the field names are stripped.
   std::optional<Error> read(const InputVarType& _var) const {
+    if constexpr (ProcessorsType::fail_fast_) {
+      if (!errors_->empty()) {
+        return std::nullopt;
+      }
+    }
     if (i_ == size_) {
       std::stringstream stream;
       stream << "Expected a maximum of " << std::to_string(size_)
@@ -58,21 +65,31 @@ class ViewReaderWithStrippedFieldNames {
     using OriginalType = typename FieldType::Type;
     using T =
         std::remove_cvref_t<std::remove_pointer_t<typename FieldType::Type>>;
+    using ParserType = Parser<R, W, T, ProcessorsType>;
     constexpr auto name = FieldType::name();
     if (_i == i) {
       std::get<i>(*_found) = true;
-      auto res = Parser<R, W, T, ProcessorsType>::read(_r, _var);
-      if (!res) {
-        std::stringstream stream;
-        stream << "Failed to parse field '" << std::string(name)
-               << "': " << res.error()->what();
-        _errors->emplace_back(Error(stream.str()));
-        return;
-      }
-      if constexpr (std::is_pointer_v<OriginalType>) {
-        move_to(rfl::get<i>(*_view), &(*res));
+      if constexpr (std::is_pointer_v<OriginalType> &&
+                    reads_in_place<ParserType>) {
+        auto err = ParserType::read_in_place(
+            _r, _var, const_cast<T*>(rfl::get<i>(*_view)));
+        if (err) {
+          _errors->emplace_back(
+              add_field_to_error<ProcessorsType>(name, std::move(*err)));
+          return;
+        }
       } else {
-        rfl::get<i>(*_view) = std::move(*res);
+        auto res = ParserType::read(_r, _var);
+        if (!res) {
+          _errors->emplace_back(add_field_to_error<ProcessorsType>(
+              name, std::move(*res.error())));
+          return;
+        }
+        if constexpr (std::is_pointer_v<OriginalType>) {
+          move_to(rfl::get<i>(*_view), &(*res));
+        } else {
+          rfl::get<i>(*_view) = std::move(*res);
+        }
       }
       std::get<i>(*_set) = true;
     }
@@ -0,0 +1,30 @@
+#ifndef RFL_PARSING_ADDFIELDTOERROR_HPP_
+#define RFL_PARSING_ADDFIELDTOERROR_HPP_
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../Result.hpp"
+
+namespace rfl::parsing {
+
+/// Adds the name of the field in which _err occurred to the error message.
+/// When rfl::FailFast is passed, the name is only recorded and the message
+/// is put together when what() is first called.
+template <class ProcessorsType>
+Error add_field_to_error(const std::string_view _name, Error&& _err) {
+  if constexpr (ProcessorsType::fail_fast_) {
+    _err.add_field_to_path(_name);
+    return std::move(_err);
+  } else {
+    std::stringstream stream;
+    stream << "Failed to parse field '" << _name << "': " << _err.what();
+    return Error(stream.str());
+  }
+}
+
+}  // namespace rfl::parsing
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef RFL_PARSING_READSINPLACE_HPP_
+#define RFL_PARSING_READSINPLACE_HPP_
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a parser can construct its type directly in
+/// uninitialized memory using read_in_place(...), instead of returning it
+/// from read(...) and leaving it to the caller to move it into place.
+template <class ParserType>
+concept reads_in_place = requires { requires ParserType::reads_in_place_; };
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
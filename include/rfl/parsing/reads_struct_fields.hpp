@@ -0,0 +1,20 @@
+#ifndef RFL_PARSING_READSSTRUCTFIELDS_HPP_
+#define RFL_PARSING_READSSTRUCTFIELDS_HPP_
+
+#include <type_traits>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether an object reader assigns the fields of a struct, as
+/// opposed to the entries of a map. Readers can pass such object readers
+/// fields that are not part of the input, like the XML text content.
+template <class ObjectReader>
+concept reads_struct_fields = requires {
+  requires std::remove_cvref_t<ObjectReader>::reads_struct_fields_;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
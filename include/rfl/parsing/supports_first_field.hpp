@@ -0,0 +1,28 @@
+#ifndef RFL_PARSING_SUPPORTSFIRSTFIELD_HPP_
+#define RFL_PARSING_SUPPORTSFIRSTFIELD_HPP_
+
+#include <concepts>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can retrieve the first field of an object,
+/// including its name, without searching for it. This is used to find the
+/// discriminator of a tagged union, which rfl always writes as the first
+/// field. get_first_field(...) returns std::nullopt if the object is empty.
+template <class R>
+concept supports_first_field =
+    requires(R r, typename R::InputObjectType obj) {
+  {
+    r.get_first_field(obj)
+    } -> std::same_as<
+        std::optional<std::pair<std::string_view, typename R::InputVarType>>>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef RFL_PARSING_SUPPORTSKEYTOKENS_HPP_
+#define RFL_PARSING_SUPPORTSKEYTOKENS_HPP_
+
+#include <concepts>
+#include <string>
+#include <string_view>
+
+#include "KeyToken.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a writer supports key tokens, meaning that the field
+/// names known at compile time are encoded at compile time as well.
+///
+/// Such a writer must provide a constexpr function
+/// encode_key(std::string_view _name, char* _out), which returns the number
+/// of bytes needed to encode _name and writes them into _out, unless _out is
+/// a nullptr. It must also provide overloads of the *_to_object(...)
+/// functions that take a KeyToken instead of the name.
+template <class W>
+concept supports_key_tokens = requires(W w, std::string_view name,
+                                       std::string basic_value, KeyToken key,
+                                       typename W::OutputObjectType obj,
+                                       size_t size, char* out) {
+  { W::encode_key(name, out) } -> std::same_as<size_t>;
+
+  {
+    w.add_array_to_object(key, size, &obj)
+    } -> std::same_as<typename W::OutputArrayType>;
+
+  {
+    w.add_object_to_object(key, size, &obj)
+    } -> std::same_as<typename W::OutputObjectType>;
+
+  {
+    w.add_value_to_object(key, basic_value, &obj)
+    } -> std::same_as<typename W::OutputVarType>;
+
+  {
+    w.add_null_to_object(key, &obj)
+    } -> std::same_as<typename W::OutputVarType>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
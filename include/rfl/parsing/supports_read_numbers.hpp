@@ -0,0 +1,34 @@
+#ifndef RFL_PARSING_SUPPORTSREADNUMBERS_HPP_
+#define RFL_PARSING_SUPPORTSREADNUMBERS_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "../internal/has_reflector.hpp"
+#include "supports_size_hint.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can read an entire array of numbers of type T
+/// at once, so we do not have to go through Parser::read and to_basic_type
+/// for every single element.
+///
+/// read_numbers must read the first elements of the array into _out, using
+/// the same conversion rules as to_basic_type<T>, and stop at the first
+/// element that cannot be converted. It returns the number of elements read.
+template <class R, class T>
+concept supports_read_numbers =
+    std::is_arithmetic_v<T> && !std::is_const_v<T> &&
+    !std::is_same_v<T, bool> && !internal::has_read_reflector<T> &&
+    supports_size_hint<R, typename R::InputArrayType> &&
+    requires(R r, typename R::InputArrayType arr, std::span<T> out) {
+  { r.read_numbers(arr, out) } -> std::same_as<size_t>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef RFL_PARSING_SUPPORTSSIZEHINT_HPP_
+#define RFL_PARSING_SUPPORTSSIZEHINT_HPP_
+
+#include <concepts>
+#include <cstddef>
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader can tell how many elements an array or object
+/// contains before reading it. The size hint must be cheap to compute and
+/// must never exceed the number of elements that are actually there by much,
+/// because it is used to reserve memory up front. A size hint of 0 means that
+/// the size is unknown.
+template <class R, class InputType>
+concept supports_size_hint = requires(R r, InputType input) {
+  { r.size_hint(input) } -> std::same_as<size_t>;
+};
+
+/// Reserves memory for the elements of _container, if both the reader and
+/// the container support it.
+template <class R, class InputType, class ContainerType>
+void reserve_from_size_hint(const R& _r, const InputType& _input,
+                            ContainerType* _container) {
+  if constexpr (supports_size_hint<R, InputType> &&
+                requires(ContainerType c, size_t n) { c.reserve(n); }) {
+    _container->reserve(_r.size_hint(_input));
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
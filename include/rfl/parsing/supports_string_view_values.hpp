@@ -0,0 +1,21 @@
+#ifndef RFL_PARSING_SUPPORTSSTRINGVIEWVALUES_HPP_
+#define RFL_PARSING_SUPPORTSSTRINGVIEWVALUES_HPP_
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a writer accepts std::string_view in
+/// add_value_to_array(...), add_value_to_object(...) and value_as_root(...).
+/// This is used to write strings that are not owned by the value being
+/// written, such as the names of enums, without allocating a std::string.
+///
+/// Such a writer must declare
+/// static constexpr bool supports_string_view_values_ = true. The view is
+/// only valid for the duration of the call, so the writer must copy it.
+template <class W>
+concept supports_string_view_values = W::supports_string_view_values_;
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
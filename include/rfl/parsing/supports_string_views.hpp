@@ -0,0 +1,22 @@
+#ifndef RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+#define RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a reader supports std::string_view in
+/// to_basic_type(...), returning a view into the underlying document. This
+/// is used to avoid copying strings that are only needed for a lookup, such
+/// as the names of enums or the discriminators of tagged unions.
+///
+/// Such a reader must declare
+/// static constexpr bool supports_string_views_ = true. It may still fail to
+/// return a view for some strings, in which case the string is read as a
+/// std::string instead.
+template <class R>
+concept supports_string_views = R::supports_string_views_;
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef RFL_PARSING_SUPPORTSWRITENUMBERS_HPP_
+#define RFL_PARSING_SUPPORTSWRITENUMBERS_HPP_
+
+#include <concepts>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "../internal/has_reflector.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Determines whether a writer can write an entire array of numbers of type T
+/// at once, which allows formats with native support for packed arrays to
+/// use it.
+template <class W, class T>
+concept supports_write_numbers =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    !std::is_same_v<T, char> && !internal::has_write_reflector<T> &&
+    requires(W w, std::string_view name, std::span<const T> numbers,
+             typename W::OutputArrayType arr,
+             typename W::OutputObjectType obj) {
+  {
+    w.add_numbers_to_array(numbers, &arr)
+    } -> std::same_as<typename W::OutputVarType>;
+
+  {
+    w.add_numbers_to_object(name, numbers, &obj)
+    } -> std::same_as<typename W::OutputVarType>;
+
+  { w.numbers_as_root(numbers) } -> std::same_as<typename W::OutputVarType>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef RFL_TO_COMPACT_GENERIC_HPP_
+#define RFL_TO_COMPACT_GENERIC_HPP_
+
+#include "CompactGeneric.hpp"
+#include "generic/write.hpp"
+
+namespace rfl {
+
+/// Generates a compact generic that is equivalent to the struct _t.
+template <class... Ps>
+CompactGeneric to_compact_generic(const auto& _t) {
+  return rfl::generic::write_compact<Ps...>(_t);
+}
+
+}  // namespace rfl
+
+#endif
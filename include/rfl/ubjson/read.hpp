@@ -9,6 +9,7 @@
 
 #include "../Processors.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -33,6 +34,22 @@ Result<internal::wrap_in_rfl_array_t<T>> read(std::istream& _stream) {
   return Parser<T, Processors<Ps...>>::read(r, InputVarType{&val});
 }
 
+/// Parses UBJSON into an existing object. Unlike read(...), this reuses the
+/// memory the object already owns. If an error occurs, the object is left in
+/// a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::vector<char>& _bytes) {
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, Processors<Ps...>>;
+  auto val = jsoncons::ubjson::decode_ubjson<jsoncons::json>(_bytes);
+  auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, InputVarType{&val}, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
 }  // namespace rfl::ubjson
 
 #endif
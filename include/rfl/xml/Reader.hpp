@@ -11,7 +11,7 @@
 
 #include "../Result.hpp"
 #include "../always_false.hpp"
-#include "../parsing/is_view_reader.hpp"
+#include "../parsing/reads_struct_fields.hpp"
 
 namespace rfl {
 namespace xml {
@@ -113,7 +113,7 @@ struct Reader {
       _object_reader.read(std::string_view(attr.name()), InputVarType(attr));
     }
 
-    if constexpr (parsing::is_view_reader_v<ObjectReader>) {
+    if constexpr (parsing::reads_struct_fields<ObjectReader>) {
       _object_reader.read(std::string_view("xml_content"),
                           InputVarType(_obj.node_));
     }
@@ -8,6 +8,7 @@
 #include "../Processors.hpp"
 #include "../internal/get_type_name.hpp"
 #include "../internal/remove_namespaces.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 
@@ -48,6 +49,39 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(xml_str);
 }
 
+/// Parses a XML var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses XML into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::string& _xml_str) {
+  pugi::xml_document doc;
+  const auto result = doc.load_string(_xml_str.c_str());
+  if (!result) {
+    return Error("XML string could not be parsed: " +
+                 std::string(result.description()));
+  }
+  const auto var = InputVarType(doc.first_child());
+  return read_into<Ps...>(_obj, var);
+}
+
 }  // namespace xml
 }  // namespace rfl
 
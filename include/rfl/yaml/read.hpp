@@ -8,6 +8,7 @@
 
 #include "../Processors.hpp"
 #include "../internal/wrap_in_rfl_array_t.hpp"
+#include "../parsing/InPlaceParser.hpp"
 #include "Parser.hpp"
 #include "Reader.hpp"
 namespace rfl {
@@ -45,6 +46,37 @@ auto read(std::istream& _stream) {
   return read<T, Ps...>(yaml_str);
 }
 
+/// Parses a YAML var into an existing object. Unlike read(...), this reuses
+/// the memory the object already owns. If an error occurs, the object is left
+/// in a valid, but unspecified state.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const InputVarType& _var) {
+  using ProcessorsType = Processors<Ps...>;
+  static_assert(!ProcessorsType::no_field_names_,
+                "The NoFieldNames processor is not supported for BSON, XML, "
+                "TOML, or YAML.");
+  using InPlaceParserType =
+      parsing::InPlaceParser<Reader, Writer, T, ProcessorsType>;
+  const auto r = Reader();
+  auto err = InPlaceParserType::read_into(r, _var, &_obj);
+  if (err) {
+    return *err;
+  }
+  return Nothing{};
+}
+
+/// Parses YAML into an existing object, reusing the memory the object already
+/// owns.
+template <class... Ps, class T>
+Result<Nothing> read_into(T& _obj, const std::string& _yaml_str) {
+  try {
+    const auto var = InputVarType(YAML::Load(_yaml_str));
+    return read_into<Ps...>(_obj, var);
+  } catch (std::exception& e) {
+    return Error(e.what());
+  }
+}
+
 }  // namespace yaml
 }  // namespace rfl
 
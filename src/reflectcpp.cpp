@@ -29,7 +29,12 @@ SOFTWARE.
 // Also, this speeds up compile time, compared to multiple separate .cpp files
 // compilation.
 
+#include "rfl/CompactGeneric.cpp"
 #include "rfl/Generic.cpp"
+#include "rfl/ThreadPool.cpp"
+#include "rfl/io/MappedFile.cpp"
+#include "rfl/generic/CompactReader.cpp"
+#include "rfl/generic/CompactWriter.cpp"
 #include "rfl/generic/Reader.cpp"
 #include "rfl/generic/Writer.cpp"
 #include "rfl/parsing/schema/Type.cpp"
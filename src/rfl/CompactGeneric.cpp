@@ -0,0 +1,440 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/CompactGeneric.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+namespace rfl {
+
+static_assert(sizeof(CompactGeneric::Value) == 16,
+              "A CompactGeneric::Value should take 16 bytes.");
+
+static_assert(std::is_trivially_copyable_v<CompactGeneric::Value>,
+              "A CompactGeneric::Value must be trivially copyable.");
+
+/// Hands out memory from large blocks, which are only freed when the arena
+/// is destroyed.
+class CompactGeneric::Arena {
+ public:
+  Arena() : pos_(0) {}
+
+  ~Arena() = default;
+
+  void* allocate(const size_t _size, const size_t _alignment) {
+    auto pos = (pos_ + _alignment - 1) & ~(_alignment - 1);
+    if (blocks_.size() == 0 || pos + _size > blocks_.back().size_) {
+      add_block(_size);
+      pos = 0;
+    }
+    pos_ = pos + _size;
+    return blocks_.back().data_.get() + pos;
+  }
+
+  template <class T>
+  T* allocate_array(const size_t _n) {
+    return static_cast<T*>(allocate(_n * sizeof(T), alignof(T)));
+  }
+
+  /// The copy is null-terminated, because some writers expect the keys to
+  /// be.
+  const char* copy_string(const std::string_view _str) {
+    auto ptr = allocate_array<char>(_str.size() + 1);
+    std::memcpy(ptr, _str.data(), _str.size());
+    ptr[_str.size()] = '\0';
+    return ptr;
+  }
+
+  size_t capacity() const noexcept {
+    size_t total = 0;
+    for (const auto& b : blocks_) {
+      total += b.size_;
+    }
+    return total;
+  }
+
+ private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data_;
+    size_t size_;
+  };
+
+  void add_block(const size_t _min_size) {
+    const auto prev_size = blocks_.size() == 0 ? 0 : blocks_.back().size_;
+    const auto size = std::max(
+        _min_size, std::clamp(2 * prev_size, min_block_size_, max_block_size_));
+    blocks_.emplace_back(
+        Block{.data_ = std::make_unique_for_overwrite<std::byte[]>(size),
+              .size_ = size});
+  }
+
+ private:
+  static constexpr size_t min_block_size_ = 4096;
+
+  /// Large documents are spread over many blocks of this size instead of
+  /// doubling the block size forever, which limits the unused memory at the
+  /// end of the last block.
+  static constexpr size_t max_block_size_ = 1024 * 1024;
+
+  /// The blocks of memory, the last of which is the one currently in use.
+  std::vector<Block> blocks_;
+
+  /// The position of the next allocation within the last block.
+  size_t pos_;
+};
+
+namespace {
+
+void add_generic(const std::string_view _key, const Generic& _g,
+                 CompactGeneric::Builder* _builder) {
+  const auto handle = [&](const auto& _v) {
+    using T = std::remove_cvref_t<decltype(_v)>;
+    if constexpr (std::is_same<T, bool>()) {
+      _builder->add_bool(_key, _v);
+    } else if constexpr (std::is_same<T, int>()) {
+      _builder->add_int(_key, _v);
+    } else if constexpr (std::is_same<T, double>()) {
+      _builder->add_double(_key, _v);
+    } else if constexpr (std::is_same<T, std::string>()) {
+      _builder->add_string(_key, _v);
+    } else if constexpr (std::is_same<T, Generic::Object>()) {
+      const auto h = _builder->begin_object(_key);
+      for (const auto& [k, v] : _v) {
+        add_generic(k, v, _builder);
+      }
+      _builder->end(h);
+    } else if constexpr (std::is_same<T, Generic::Array>()) {
+      const auto h = _builder->begin_array(_key);
+      for (const auto& v : _v) {
+        add_generic(std::string_view(), v, _builder);
+      }
+      _builder->end(h);
+    } else {
+      _builder->add_null(_key);
+    }
+  };
+  std::visit(handle, _g.get());
+}
+
+Generic value_to_generic(const CompactGeneric::Value& _v) {
+  using Type = CompactGeneric::Type;
+  switch (_v.type()) {
+    case Type::boolean:
+      return Generic(*_v.to_bool());
+
+    case Type::integer: {
+      const auto val = *_v.to_int();
+      if (val < std::numeric_limits<int>::min() ||
+          val > std::numeric_limits<int>::max()) {
+        return Generic(static_cast<double>(val));
+      }
+      return Generic(static_cast<int>(val));
+    }
+
+    case Type::floating_point:
+      return Generic(*_v.to_double());
+
+    case Type::string:
+      return Generic(*_v.to_string());
+
+    case Type::array: {
+      auto arr = Generic::Array();
+      arr.reserve(_v.size());
+      const auto elements = _v.to_array().value();
+      for (const auto& e : elements) {
+        arr.emplace_back(value_to_generic(e));
+      }
+      return Generic(std::move(arr));
+    }
+
+    case Type::object: {
+      auto obj = Generic::Object();
+      const auto members = _v.to_object().value();
+      for (const auto& m : members) {
+        obj.insert(m.key_, value_to_generic(m.value_));
+      }
+      return Generic(std::move(obj));
+    }
+
+    default:
+      return Generic(Generic::Null);
+  }
+}
+
+}  // namespace
+
+size_t CompactGeneric::Value::size() const noexcept {
+  switch (type()) {
+    case Type::string:
+      return small_.is_small_ ? small_.size_ : large_.size_;
+    case Type::array:
+    case Type::object:
+      return large_.size_;
+    default:
+      return 0;
+  }
+}
+
+const CompactGeneric::Value* CompactGeneric::Value::find(
+    const std::string_view _key) const noexcept {
+  if (type() != Type::object) {
+    return nullptr;
+  }
+  const auto end = large_.members_ + large_.size_;
+  const auto it = std::find_if(large_.members_, end,
+                               [&](const auto& m) { return m.key_ == _key; });
+  return it == end ? nullptr : &it->value_;
+}
+
+Result<std::span<const CompactGeneric::Value>>
+CompactGeneric::Value::to_array() const noexcept {
+  if (type() != Type::array) {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to an "
+        "array.");
+  }
+  return std::span<const Value>(large_.values_, large_.size_);
+}
+
+Result<bool> CompactGeneric::Value::to_bool() const noexcept {
+  if (type() != Type::boolean) {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to a "
+        "boolean.");
+  }
+  return large_.bool_;
+}
+
+Result<double> CompactGeneric::Value::to_double() const noexcept {
+  if (type() == Type::floating_point) {
+    return large_.double_;
+  } else if (type() == Type::integer) {
+    return static_cast<double>(large_.int_);
+  } else {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to a "
+        "double.");
+  }
+}
+
+Result<int64_t> CompactGeneric::Value::to_int() const noexcept {
+  if (type() != Type::integer) {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to an "
+        "integer.");
+  }
+  return large_.int_;
+}
+
+Result<std::span<const CompactGeneric::Member>>
+CompactGeneric::Value::to_object() const noexcept {
+  if (type() != Type::object) {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to an "
+        "object.");
+  }
+  return std::span<const Member>(large_.members_, large_.size_);
+}
+
+Result<std::string> CompactGeneric::Value::to_string() const noexcept {
+  return to_string_view().transform(
+      [](const auto _str) { return std::string(_str); });
+}
+
+Result<std::string_view> CompactGeneric::Value::to_string_view()
+    const noexcept {
+  if (type() != Type::string) {
+    return Error(
+        "rfl::CompactGeneric: Could not cast the underlying value to a "
+        "string.");
+  }
+  if (small_.is_small_) {
+    return std::string_view(small_.chars_, small_.size_);
+  }
+  return std::string_view(large_.chars_, large_.size_);
+}
+
+CompactGeneric::Builder::Builder() : arena_(std::make_shared<Arena>()) {}
+
+CompactGeneric::Builder::Builder(Builder&& _other) noexcept = default;
+
+CompactGeneric::Builder::~Builder() = default;
+
+void CompactGeneric::Builder::add_bool(const std::string_view _key,
+                                       const bool _val) {
+  auto v = make_value(Type::boolean);
+  v.large_.bool_ = _val;
+  push(_key, v);
+}
+
+void CompactGeneric::Builder::add_double(const std::string_view _key,
+                                         const double _val) {
+  auto v = make_value(Type::floating_point);
+  v.large_.double_ = _val;
+  push(_key, v);
+}
+
+void CompactGeneric::Builder::add_int(const std::string_view _key,
+                                      const int64_t _val) {
+  auto v = make_value(Type::integer);
+  v.large_.int_ = _val;
+  push(_key, v);
+}
+
+void CompactGeneric::Builder::add_null(const std::string_view _key) {
+  push(_key, Value());
+}
+
+void CompactGeneric::Builder::add_string(const std::string_view _key,
+                                         const std::string_view _val) {
+  Value v;
+  if (_val.size() <= Value::max_small_size_) {
+    v.small_.type_ = Type::string;
+    v.small_.is_small_ = true;
+    v.small_.size_ = static_cast<uint8_t>(_val.size());
+    std::memcpy(v.small_.chars_, _val.data(), _val.size());
+  } else {
+    if (_val.size() > std::numeric_limits<uint32_t>::max()) {
+      throw std::length_error(
+          "rfl::CompactGeneric: Strings must be shorter than 4 GB.");
+    }
+    v = make_value(Type::string);
+    v.large_.size_ = static_cast<uint32_t>(_val.size());
+    v.large_.chars_ = arena_->copy_string(_val);
+  }
+  push(_key, v);
+}
+
+size_t CompactGeneric::Builder::begin_array(const std::string_view _key) {
+  auto v = make_value(Type::array);
+  push(_key, v);
+  return stack_.size() - 1;
+}
+
+size_t CompactGeneric::Builder::begin_object(const std::string_view _key) {
+  auto v = make_value(Type::object);
+  push(_key, v);
+  return stack_.size() - 1;
+}
+
+CompactGeneric CompactGeneric::Builder::build() {
+  const auto root = stack_.size() == 0 ? Value() : stack_.front().value_;
+  stack_.clear();
+  keys_.clear();
+  return CompactGeneric(std::move(arena_), root);
+}
+
+void CompactGeneric::Builder::end(const size_t _handle) {
+  auto& large = stack_[_handle].value_.large_;
+  const auto begin = stack_.begin() + static_cast<std::ptrdiff_t>(_handle + 1);
+  const auto size = static_cast<size_t>(stack_.end() - begin);
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error(
+        "rfl::CompactGeneric: Arrays and objects must have less than 2^32 "
+        "elements.");
+  }
+  large.size_ = static_cast<uint32_t>(size);
+  if (large.type_ == Type::array) {
+    auto values = arena_->allocate_array<Value>(size);
+    std::transform(begin, stack_.end(), values,
+                   [](const auto& m) { return m.value_; });
+    large.values_ = values;
+  } else {
+    auto members = arena_->allocate_array<Member>(size);
+    std::uninitialized_copy(begin, stack_.end(), members);
+    large.members_ = members;
+  }
+  stack_.erase(begin, stack_.end());
+}
+
+std::string_view CompactGeneric::Builder::intern(const std::string_view _key) {
+  if (_key.size() == 0) {
+    return std::string_view("");
+  }
+  const auto it = keys_.find(_key);
+  if (it != keys_.end()) {
+    return *it;
+  }
+  const auto key = std::string_view(arena_->copy_string(_key), _key.size());
+  keys_.insert(key);
+  return key;
+}
+
+CompactGeneric::Value CompactGeneric::Builder::make_value(
+    const Type _type) noexcept {
+  Value v;
+  v.large_.type_ = _type;
+  v.large_.is_small_ = false;
+  v.large_.size_ = 0;
+  v.large_.int_ = 0;
+  return v;
+}
+
+void CompactGeneric::Builder::push(const std::string_view _key,
+                                   const Value& _val) {
+  stack_.emplace_back(Member{.key_ = intern(_key), .value_ = _val});
+}
+
+CompactGeneric::Builder& CompactGeneric::Builder::operator=(
+    Builder&& _other) noexcept = default;
+
+CompactGeneric::CompactGeneric() noexcept : arena_(nullptr), root_() {}
+
+CompactGeneric::CompactGeneric(const Generic& _g) {
+  auto builder = Builder();
+  add_generic(std::string_view(), _g, &builder);
+  *this = builder.build();
+}
+
+CompactGeneric::CompactGeneric(std::shared_ptr<const Arena>&& _arena,
+                               const Value& _root)
+    : arena_(std::move(_arena)), root_(_root) {}
+
+CompactGeneric::CompactGeneric(const CompactGeneric& _other) noexcept =
+    default;
+
+CompactGeneric::CompactGeneric(CompactGeneric&& _other) noexcept = default;
+
+CompactGeneric::~CompactGeneric() = default;
+
+size_t CompactGeneric::memory_usage() const noexcept {
+  return sizeof(CompactGeneric) + (arena_ ? arena_->capacity() : 0);
+}
+
+Generic CompactGeneric::to_generic() const { return value_to_generic(root_); }
+
+CompactGeneric& CompactGeneric::operator=(
+    const CompactGeneric& _other) noexcept = default;
+
+CompactGeneric& CompactGeneric::operator=(CompactGeneric&& _other) noexcept =
+    default;
+
+}  // namespace rfl
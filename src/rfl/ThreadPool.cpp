@@ -0,0 +1,129 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace rfl {
+
+ThreadPool::ThreadPool(const size_t _num_workers)
+    : chunk_size_(1),
+      ctx_(nullptr),
+      generation_(0),
+      n_(0),
+      next_(0),
+      num_active_(0),
+      stop_(false),
+      task_(nullptr) {
+  for (size_t i = 1; i < std::max(_num_workers, size_t(1)); ++i) {
+    threads_.emplace_back([this, i]() { work(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stop_ = true;
+  }
+  cv_start_.notify_all();
+  for (auto& t : threads_) {
+    t.join();
+  }
+}
+
+size_t ThreadPool::default_num_workers() noexcept {
+  return std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                  size_t(1));
+}
+
+void ThreadPool::process(const size_t _worker) {
+  while (true) {
+    const auto begin = next_.fetch_add(chunk_size_);
+    if (begin >= n_) {
+      return;
+    }
+    const auto end = std::min(begin + chunk_size_, n_);
+    for (auto i = begin; i < end; ++i) {
+      task_(ctx_, _worker, i);
+    }
+  }
+}
+
+void ThreadPool::run(const size_t _n, TaskType _task, const void* _ctx) {
+  std::lock_guard<std::mutex> run_lock(run_mtx_);
+
+  if (threads_.size() == 0 || _n <= 1) {
+    for (size_t i = 0; i < _n; ++i) {
+      _task(_ctx, 0, i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    // Small chunks balance the load better, large chunks cause less
+    // contention on next_. Aiming for about eight chunks per worker is a
+    // reasonable compromise.
+    chunk_size_ = std::max(_n / (num_workers() * 8), size_t(1));
+    ctx_ = _ctx;
+    n_ = _n;
+    next_.store(0);
+    num_active_ = threads_.size();
+    task_ = _task;
+    ++generation_;
+  }
+  cv_start_.notify_all();
+
+  process(0);
+
+  std::unique_lock<std::mutex> lock(mtx_);
+  cv_done_.wait(lock, [this]() { return num_active_ == 0; });
+}
+
+void ThreadPool::work(const size_t _worker) {
+  size_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      cv_start_.wait(lock,
+                     [&]() { return stop_ || generation_ != generation; });
+      if (stop_) {
+        return;
+      }
+      generation = generation_;
+    }
+
+    process(_worker);
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (--num_active_ == 0) {
+      cv_done_.notify_one();
+    }
+  }
+}
+
+}  // namespace rfl
@@ -4,25 +4,23 @@ namespace rfl::cbor {
 
 rfl::Result<Reader::InputVarType> Reader::get_field_from_array(
     const size_t _idx, const InputArrayType& _arr) const noexcept {
+  if (_arr.typed_tag_ != 0) {
+    return Error("Cannot access the elements of a typed array by index.");
+  }
   InputVarType var;
   auto err = cbor_value_enter_container(&_arr.val_, &var.val_);
-  if (err != CborNoError && err != CborErrorOutOfMemory) {
-    return Error(cbor_error_string(err));
-  }
-  size_t length = 0;
-  err = cbor_value_get_array_length(&_arr.val_, &length);
-  if (err != CborNoError && err != CborErrorOutOfMemory) {
+  if (err != CborNoError) {
     return Error(cbor_error_string(err));
   }
-  if (_idx >= length) {
-    return Error("Index " + std::to_string(_idx) + " of of bounds.");
-  }
-  for (size_t i = 0; i < _idx; ++i) {
+  for (size_t i = 0; i < _idx && !cbor_value_at_end(&var.val_); ++i) {
     err = cbor_value_advance(&var.val_);
-    if (err != CborNoError && err != CborErrorOutOfMemory) {
+    if (err != CborNoError) {
       return Error(cbor_error_string(err));
     }
   }
+  if (cbor_value_at_end(&var.val_)) {
+    return Error("Index " + std::to_string(_idx) + " of of bounds.");
+  }
   return var;
 }
 
@@ -34,12 +32,7 @@ rfl::Result<Reader::InputVarType> Reader::get_field_from_object(
   if (err != CborNoError) {
     return Error(cbor_error_string(err));
   }
-  size_t length = 0;
-  err = cbor_value_get_map_length(&_obj.val_, &length);
-  if (err != CborNoError) {
-    return Error(cbor_error_string(err));
-  }
-  for (size_t i = 0; i < length; ++i) {
+  while (!cbor_value_at_end(&var.val_)) {
     if (!cbor_value_is_text_string(&var.val_)) {
       return Error("Expected the key to be a string value.");
     }
@@ -62,16 +55,42 @@ rfl::Result<Reader::InputVarType> Reader::get_field_from_object(
   return Error("No field named '" + _name + "' was found.");
 }
 
+std::optional<std::pair<std::string_view, Reader::InputVarType>>
+Reader::get_first_field(const InputObjectType& _obj) const noexcept {
+  InputVarType var;
+  if (cbor_value_enter_container(&_obj.val_, &var.val_) != CborNoError ||
+      cbor_value_at_end(&var.val_) || !cbor_value_is_text_string(&var.val_)) {
+    return std::nullopt;
+  }
+  const char* ptr = nullptr;
+  size_t size = 0;
+  if (get_string_view(&var.val_, &ptr, &size) != CborNoError ||
+      cbor_value_advance(&var.val_) != CborNoError) {
+    return std::nullopt;
+  }
+  return std::make_pair(std::string_view(ptr, size), var);
+}
+
 bool Reader::is_empty(const InputVarType& _var) const noexcept {
   return cbor_value_is_null(&_var.val_);
 }
 
+size_t Reader::size_hint(const InputArrayType& _arr) const noexcept {
+  if (_arr.typed_tag_ == 0) {
+    return 0;
+  }
+  return _arr.typed_data_.size() / typed_array_element_size(_arr.typed_tag_);
+}
+
 rfl::Result<Reader::InputArrayType> Reader::to_array(
     const InputVarType& _var) const noexcept {
+  if (cbor_value_is_tag(&_var.val_)) {
+    return to_typed_array(_var);
+  }
   if (!cbor_value_is_array(&_var.val_)) {
     return Error("Could not cast to an array.");
   }
-  return InputArrayType{_var.val_};
+  return InputArrayType{_var.val_, _var.cursor_};
 }
 
 rfl::Result<Reader::InputObjectType> Reader::to_object(
@@ -79,7 +98,80 @@ rfl::Result<Reader::InputObjectType> Reader::to_object(
   if (!cbor_value_is_map(&_var.val_)) {
     return Error("Could not cast to an object.");
   }
-  return InputObjectType{_var.val_};
+  return InputObjectType{_var.val_, _var.cursor_};
+}
+
+rfl::Result<Reader::InputArrayType> Reader::to_typed_array(
+    const InputVarType& _var) const noexcept {
+  CborTag tag = 0;
+  auto err = cbor_value_get_tag(&_var.val_, &tag);
+  if (err != CborNoError) {
+    return Error(cbor_error_string(err));
+  }
+  const auto element_size = typed_array_element_size(tag);
+  if (element_size == 0) {
+    return Error("Could not cast to an array: Unsupported tag " +
+                 std::to_string(tag) + ".");
+  }
+  auto next = _var.val_;
+  err = cbor_value_advance_fixed(&next);
+  if (err != CborNoError) {
+    return Error(cbor_error_string(err));
+  }
+  if (!cbor_value_is_byte_string(&next)) {
+    return Error("Expected the content of a typed array to be a byte string.");
+  }
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  err = get_bytestring_view(&next, &data, &size);
+  if (err != CborNoError) {
+    return Error(cbor_error_string(err));
+  }
+  if (size % element_size != 0) {
+    return Error("The length of the typed array must be a multiple of " +
+                 std::to_string(element_size) + ".");
+  }
+  err = cbor_value_advance(&next);
+  if (err != CborNoError) {
+    return Error(cbor_error_string(err));
+  }
+  // The content has been captured, so we can move past the typed array right
+  // away.
+  if (_var.cursor_) {
+    *_var.cursor_ = next;
+  }
+  return InputArrayType{_var.val_, _var.cursor_, tag,
+                        std::span<const uint8_t>(data, size)};
+}
+
+size_t Reader::typed_array_element_size(const CborTag _tag) noexcept {
+  switch (_tag) {
+    case 64:
+    case 68:
+    case 72:
+      return 1;
+    case 65:
+    case 69:
+    case 73:
+    case 77:
+      return 2;
+    case 66:
+    case 70:
+    case 74:
+    case 78:
+    case 81:
+    case 85:
+      return 4;
+    case 67:
+    case 71:
+    case 75:
+    case 79:
+    case 82:
+    case 86:
+      return 8;
+    default:
+      return 0;
+  }
 }
 
 CborError Reader::get_bytestring(const CborValue* _ptr,
@@ -98,6 +190,17 @@ CborError Reader::get_bytestring(const CborValue* _ptr,
   }
 }
 
+CborError Reader::get_bytestring_view(const CborValue* _ptr,
+                                      const uint8_t** _data,
+                                      size_t* _size) const noexcept {
+  // Strings of indefinite length are split into several chunks, so they
+  // cannot be represented as a single view.
+  if (!cbor_value_is_length_known(_ptr)) {
+    return CborErrorUnknownLength;
+  }
+  return cbor_value_get_byte_string_chunk(_ptr, _data, _size, NULL);
+}
+
 CborError Reader::get_string(const CborValue* _ptr,
                              std::string* _str) const noexcept {
   size_t length = 0;
@@ -113,4 +216,40 @@ CborError Reader::get_string(const CborValue* _ptr,
   }
 }
 
+CborError Reader::get_string_view(const CborValue* _ptr, const char** _data,
+                                  size_t* _size) const noexcept {
+  // Strings of indefinite length are split into several chunks, so they
+  // cannot be represented as a single view.
+  if (!cbor_value_is_length_known(_ptr)) {
+    return CborErrorUnknownLength;
+  }
+  return cbor_value_get_text_string_chunk(_ptr, _data, _size, NULL);
+}
+
+CborError Reader::leave_container(const CborValue& _container,
+                                  const CborValue& _it,
+                                  CborValue* _cursor) const noexcept {
+  if (!_cursor) {
+    return CborNoError;
+  }
+  // _container is a copy of what _cursor pointed to when the container was
+  // handed to the child parser, so this is idempotent, even if the same
+  // value is parsed more than once (which happens for variants).
+  auto next = _container;
+  const auto err = cbor_value_leave_container(&next, &_it);
+  if (err != CborNoError) {
+    return err;
+  }
+  *_cursor = next;
+  return CborNoError;
+}
+
+CborError Reader::skip_if_unread(const uint8_t* _pos,
+                                 CborValue* _it) const noexcept {
+  if (cbor_value_get_next_byte(_it) != _pos) {
+    return CborNoError;
+  }
+  return cbor_value_advance(_it);
+}
+
 }  // namespace rfl::cbor
@@ -2,7 +2,8 @@
 
 namespace rfl::cbor {
 
-Writer::Writer(CborEncoder* _encoder) : encoder_(_encoder) {}
+Writer::Writer(CborEncoder* _encoder, const bool _typed_arrays)
+    : encoder_(_encoder), typed_arrays_(_typed_arrays) {}
 
 Writer::~Writer() = default;
 
@@ -4,10 +4,14 @@ namespace rfl::flexbuf {
 
 rfl::Result<Reader::InputVarType> Reader::get_field_from_array(
     const size_t _idx, const InputArrayType& _arr) const noexcept {
-  if (_idx >= _arr.size()) {
-    return rfl::Error("Index " + std::to_string(_idx) + " of of bounds.");
-  }
-  return _arr[_idx];
+  return with_vector(
+      _arr, [&](const auto& _vec) -> rfl::Result<Reader::InputVarType> {
+        if (_idx >= _vec.size()) {
+          return rfl::Error("Index " + std::to_string(_idx) +
+                            " of of bounds.");
+        }
+        return _vec[_idx];
+      });
 }
 
 rfl::Result<Reader::InputVarType> Reader::get_field_from_object(
@@ -25,12 +29,22 @@ bool Reader::is_empty(const InputVarType& _var) const noexcept {
   return _var.IsNull();
 }
 
+size_t Reader::size_hint(const InputArrayType& _arr) const noexcept {
+  return with_vector(_arr, [](const auto& _vec) -> size_t {
+    return _vec.size();
+  });
+}
+
+size_t Reader::size_hint(const InputObjectType& _obj) const noexcept {
+  return _obj.size();
+}
+
 rfl::Result<Reader::InputArrayType> Reader::to_array(
     const InputVarType& _var) const noexcept {
-  if (!_var.IsVector()) {
+  if (!_var.IsVector() && !_var.IsTypedVector()) {
     return rfl::Error("Could not cast to Vector.");
   }
-  return _var.AsVector();
+  return InputArrayType{_var};
 }
 
 rfl::Result<Reader::InputObjectType> Reader::to_object(
@@ -0,0 +1,65 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/generic/CompactReader.hpp"
+
+#include <algorithm>
+
+namespace rfl::generic {
+
+rfl::Result<CompactReader::InputVarType> CompactReader::get_field_from_array(
+    const size_t _idx, const InputArrayType& _arr) const noexcept {
+  if (_idx >= _arr.size()) {
+    return rfl::Error("Index " + std::to_string(_idx) + " of of bounds.");
+  }
+  return InputVarType{&_arr[_idx]};
+}
+
+rfl::Result<CompactReader::InputVarType> CompactReader::get_field_from_object(
+    const std::string& _name, const InputObjectType& _obj) const noexcept {
+  const auto it = std::find_if(_obj.begin(), _obj.end(),
+                               [&](const auto& m) { return m.key_ == _name; });
+  if (it == _obj.end()) {
+    return rfl::Error("Key named '" + _name + "' not found.");
+  }
+  return InputVarType{&it->value_};
+}
+
+bool CompactReader::is_empty(const InputVarType& _var) const noexcept {
+  return _var.val_->is_null();
+}
+
+rfl::Result<CompactReader::InputArrayType> CompactReader::to_array(
+    const InputVarType& _var) const noexcept {
+  return _var.val_->to_array();
+}
+
+rfl::Result<CompactReader::InputObjectType> CompactReader::to_object(
+    const InputVarType& _var) const noexcept {
+  return _var.val_->to_object();
+}
+
+}  // namespace rfl::generic
@@ -0,0 +1,88 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/generic/CompactWriter.hpp"
+
+namespace rfl::generic {
+
+CompactWriter::OutputArrayType CompactWriter::array_as_root(
+    const size_t) const noexcept {
+  return OutputArray{builder_.begin_array(std::string_view())};
+}
+
+CompactWriter::OutputObjectType CompactWriter::object_as_root(
+    const size_t) const noexcept {
+  return OutputObject{builder_.begin_object(std::string_view())};
+}
+
+CompactWriter::OutputVarType CompactWriter::null_as_root() const noexcept {
+  builder_.add_null(std::string_view());
+  return OutputVarType{};
+}
+
+CompactWriter::OutputArrayType CompactWriter::add_array_to_array(
+    const size_t, OutputArrayType*) const noexcept {
+  return OutputArray{builder_.begin_array(std::string_view())};
+}
+
+CompactWriter::OutputArrayType CompactWriter::add_array_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType*) const noexcept {
+  return OutputArray{builder_.begin_array(_name)};
+}
+
+CompactWriter::OutputObjectType CompactWriter::add_object_to_array(
+    const size_t, OutputArrayType*) const noexcept {
+  return OutputObject{builder_.begin_object(std::string_view())};
+}
+
+CompactWriter::OutputObjectType CompactWriter::add_object_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType*) const noexcept {
+  return OutputObject{builder_.begin_object(_name)};
+}
+
+CompactWriter::OutputVarType CompactWriter::add_null_to_array(
+    OutputArrayType*) const noexcept {
+  builder_.add_null(std::string_view());
+  return OutputVarType{};
+}
+
+CompactWriter::OutputVarType CompactWriter::add_null_to_object(
+    const std::string_view& _name, OutputObjectType*) const noexcept {
+  builder_.add_null(_name);
+  return OutputVarType{};
+}
+
+void CompactWriter::end_array(OutputArrayType* _arr) const noexcept {
+  builder_.end(_arr->handle_);
+}
+
+void CompactWriter::end_object(OutputObjectType* _obj) const noexcept {
+  builder_.end(_obj->handle_);
+}
+
+}  // namespace rfl::generic
@@ -0,0 +1,192 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/io/MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rfl::io {
+
+MappedFile::MappedFile(MappedFile&& _other) noexcept
+    : buffer_(std::move(_other.buffer_)),
+      data_(std::exchange(_other.data_, nullptr)),
+      size_(std::exchange(_other.size_, 0)),
+      is_mapped_(std::exchange(_other.is_mapped_, false)) {}
+
+MappedFile::~MappedFile() { unmap(); }
+
+MappedFile& MappedFile::operator=(MappedFile&& _other) noexcept {
+  if (this == &_other) {
+    return *this;
+  }
+  unmap();
+  buffer_ = std::move(_other.buffer_);
+  data_ = std::exchange(_other.data_, nullptr);
+  size_ = std::exchange(_other.size_, 0);
+  is_mapped_ = std::exchange(_other.is_mapped_, false);
+  return *this;
+}
+
+#ifdef _WIN32
+
+Result<MappedFile> MappedFile::open(const std::string& _fname) noexcept {
+  const auto not_found = [&]() {
+    return Error("Unable to open file '" + _fname +
+                 "' or file could not be found.");
+  };
+
+  const HANDLE file =
+      CreateFileA(_fname.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return not_found();
+  }
+
+  if (GetFileType(file) != FILE_TYPE_DISK) {
+    auto buffer = std::string();
+    char chunk[65536];
+    DWORD num_read = 0;
+    while (ReadFile(file, chunk, sizeof(chunk), &num_read, NULL) &&
+           num_read != 0) {
+      buffer.append(chunk, num_read);
+    }
+    CloseHandle(file);
+    return MappedFile(std::move(buffer));
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    return not_found();
+  }
+
+  if (size.QuadPart == 0) {
+    CloseHandle(file);
+    return MappedFile(std::string());
+  }
+
+  const HANDLE mapping =
+      CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (!mapping) {
+    return Error("Could not map file '" + _fname + "' into memory.");
+  }
+
+  // The view keeps the mapping alive, so the handle can be closed.
+  const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!data) {
+    return Error("Could not map file '" + _fname + "' into memory.");
+  }
+
+  return MappedFile(static_cast<const char*>(data),
+                    static_cast<size_t>(size.QuadPart));
+}
+
+void MappedFile::unmap() noexcept {
+  if (is_mapped_) {
+    UnmapViewOfFile(data_);
+  }
+}
+
+#else
+
+Result<MappedFile> MappedFile::open(const std::string& _fname) noexcept {
+  const int fd = ::open(_fname.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return Error("Unable to open file '" + _fname +
+                 "' or file could not be found.");
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == -1) {
+    ::close(fd);
+    return Error("Unable to open file '" + _fname +
+                 "' or file could not be found.");
+  }
+
+  // Pipes, FIFOs and the files in /proc report a size of zero or no size at
+  // all, so we can only map regular files and have to read everything else.
+  if (!S_ISREG(st.st_mode)) {
+    auto buffer = std::string();
+    char chunk[65536];
+    while (true) {
+      const auto num_read = ::read(fd, chunk, sizeof(chunk));
+      if (num_read > 0) {
+        buffer.append(chunk, static_cast<size_t>(num_read));
+      } else if (num_read == 0) {
+        break;
+      } else if (errno != EINTR) {
+        ::close(fd);
+        return Error("Could not read file '" + _fname + "'.");
+      }
+    }
+    ::close(fd);
+    return MappedFile(std::move(buffer));
+  }
+
+  const auto size = static_cast<size_t>(st.st_size);
+
+  if (size == 0) {
+    ::close(fd);
+    return MappedFile(std::string());
+  }
+
+  // The mapping remains valid after the file descriptor is closed.
+  void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return Error("Could not map file '" + _fname + "' into memory.");
+  }
+
+  // This is only a hint, so we can ignore the return value.
+  madvise(data, size, MADV_SEQUENTIAL);
+
+  return MappedFile(static_cast<const char*>(data), size);
+}
+
+void MappedFile::unmap() noexcept {
+  if (is_mapped_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+#endif
+
+}  // namespace rfl::io
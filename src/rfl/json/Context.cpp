@@ -0,0 +1,127 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/json/Context.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace rfl::json {
+
+namespace {
+
+constexpr size_t align_up(const size_t _size) {
+  constexpr size_t alignment = alignof(std::max_align_t);
+  return (_size + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+Context::Context(const size_t _initial_size)
+    : pos_(0),
+      last_(nullptr),
+      alc_{&Context::yyjson_malloc, &Context::yyjson_realloc,
+           &Context::yyjson_free, this} {
+  add_block(_initial_size);
+}
+
+bool Context::add_block(const size_t _min_size) noexcept {
+  const auto prev_size = blocks_.size() == 0 ? 0 : blocks_.back().size_;
+  const auto size = align_up(std::max(_min_size, 2 * prev_size));
+  try {
+    blocks_.emplace_back(
+        Block{.data_ = std::make_unique_for_overwrite<std::byte[]>(size),
+              .size_ = size});
+  } catch (std::bad_alloc&) {
+    return false;
+  }
+  pos_ = 0;
+  last_ = nullptr;
+  return true;
+}
+
+void* Context::allocate(const size_t _size) noexcept {
+  const auto size = align_up(_size);
+  if (blocks_.size() == 0 || pos_ + size > blocks_.back().size_) {
+    if (!add_block(size)) {
+      return nullptr;
+    }
+  }
+  last_ = blocks_.back().data_.get() + pos_;
+  pos_ += size;
+  return last_;
+}
+
+size_t Context::capacity() const noexcept {
+  size_t total = 0;
+  for (const auto& b : blocks_) {
+    total += b.size_;
+  }
+  return total;
+}
+
+void* Context::reallocate(void* _ptr, const size_t _old_size,
+                          const size_t _size) noexcept {
+  if (_ptr && _ptr == last_) {
+    const auto begin = static_cast<size_t>(last_ - blocks_.back().data_.get());
+    const auto size = align_up(_size);
+    if (begin + size <= blocks_.back().size_) {
+      pos_ = begin + size;
+      return _ptr;
+    }
+  }
+  auto ptr = allocate(_size);
+  if (ptr && _ptr) {
+    std::memcpy(ptr, _ptr, std::min(_old_size, _size));
+  }
+  return ptr;
+}
+
+void Context::reset() noexcept {
+  if (blocks_.size() > 1) {
+    const auto total = capacity();
+    blocks_.clear();
+    add_block(total);
+  }
+  pos_ = 0;
+  last_ = nullptr;
+}
+
+void* Context::yyjson_malloc(void* _ctx, size_t _size) {
+  return static_cast<Context*>(_ctx)->allocate(_size);
+}
+
+void* Context::yyjson_realloc(void* _ctx, void* _ptr, size_t _old_size,
+                              size_t _size) {
+  return static_cast<Context*>(_ctx)->reallocate(_ptr, _old_size, _size);
+}
+
+void Context::yyjson_free(void*, void*) {
+  // The memory is only released when the context is reset or destroyed.
+}
+
+}  // namespace rfl::json
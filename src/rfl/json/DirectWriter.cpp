@@ -0,0 +1,301 @@
+/*
+
+MIT License
+
+Copyright (c) 2023-2024 Code17 GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "rfl/json/DirectWriter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rfl::json {
+
+namespace {
+
+/// The buffer is flushed into the stream once it exceeds this size.
+constexpr size_t flush_threshold = 64 * 1024;
+
+constexpr std::string_view indentation =
+    "                                                                ";
+
+}  // namespace
+
+DirectWriter::DirectWriter(std::string* _buffer, std::ostream* _stream,
+                           const bool _pretty)
+    : buffer_(_buffer), stream_(_stream), pretty_(_pretty) {}
+
+DirectWriter::OutputArrayType DirectWriter::array_as_root(
+    const size_t) const noexcept {
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = 0, .empty_ = true};
+}
+
+DirectWriter::OutputObjectType DirectWriter::object_as_root(
+    const size_t) const noexcept {
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = 0, .empty_ = true};
+}
+
+DirectWriter::OutputVarType DirectWriter::null_as_root() const noexcept {
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+DirectWriter::OutputArrayType DirectWriter::add_array_to_array(
+    const size_t, OutputArrayType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputArrayType DirectWriter::add_array_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_name);
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputArrayType DirectWriter::add_array_to_object(
+    const parsing::KeyToken& _key, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_key);
+  buffer_->push_back('[');
+  return OutputArrayType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputObjectType DirectWriter::add_object_to_array(
+    const size_t, OutputArrayType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputObjectType DirectWriter::add_object_to_object(
+    const std::string_view& _name, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_name);
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputObjectType DirectWriter::add_object_to_object(
+    const parsing::KeyToken& _key, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_key);
+  buffer_->push_back('{');
+  return OutputObjectType{.depth_ = _parent->depth_ + 1, .empty_ = true};
+}
+
+DirectWriter::OutputVarType DirectWriter::add_null_to_array(
+    OutputArrayType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+DirectWriter::OutputVarType DirectWriter::add_null_to_object(
+    const std::string_view& _name, OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_name);
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+DirectWriter::OutputVarType DirectWriter::add_null_to_object(
+    const parsing::KeyToken& _key, OutputObjectType* _parent) const noexcept {
+  new_element(&_parent->empty_, _parent->depth_);
+  write_key(_key);
+  buffer_->append("null");
+  return OutputVarType{};
+}
+
+void DirectWriter::close(const char _c, const bool _empty,
+                         const size_t _depth) const noexcept {
+  if (pretty_ && !_empty) {
+    indent(_depth);
+  }
+  buffer_->push_back(_c);
+}
+
+void DirectWriter::end_array(OutputArrayType* _arr) const noexcept {
+  close(']', _arr->empty_, _arr->depth_);
+  maybe_flush();
+}
+
+void DirectWriter::end_object(OutputObjectType* _obj) const noexcept {
+  close('}', _obj->empty_, _obj->depth_);
+  maybe_flush();
+}
+
+void DirectWriter::flush() const {
+  if (stream_) {
+    stream_->write(buffer_->data(), buffer_->size());
+    buffer_->clear();
+  }
+}
+
+void DirectWriter::indent(const size_t _depth) const noexcept {
+  buffer_->push_back('\n');
+  for (auto n = _depth * 4; n > 0;) {
+    const auto chunk = std::min(n, indentation.size());
+    buffer_->append(indentation.substr(0, chunk));
+    n -= chunk;
+  }
+}
+
+void DirectWriter::maybe_flush() const noexcept {
+  if (stream_ && buffer_->size() > flush_threshold) {
+    flush();
+  }
+}
+
+void DirectWriter::new_element(bool* _empty,
+                               const size_t _depth) const noexcept {
+  if (!*_empty) {
+    buffer_->push_back(',');
+  }
+  *_empty = false;
+  if (pretty_) {
+    indent(_depth + 1);
+  }
+}
+
+void DirectWriter::write_double(const double _d) const noexcept {
+  // Non-finite values cannot be represented in JSON.
+  if (!std::isfinite(_d)) {
+    buffer_->append("null");
+    return;
+  }
+
+  // We use the shortest representation that round-trips and then format it
+  // the way yyjson does: Plain notation for decimal exponents in [-6, 21),
+  // with ".0" appended to integral values, and scientific notation
+  // otherwise.
+  char buf[32];
+  const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), _d,
+                                       std::chars_format::scientific);
+
+  const char* ptr = buf;
+  if (*ptr == '-') {
+    buffer_->push_back('-');
+    ++ptr;
+  }
+
+  char digits[20];
+  int num_digits = 0;
+  for (; *ptr != 'e'; ++ptr) {
+    if (*ptr != '.') {
+      digits[num_digits++] = *ptr;
+    }
+  }
+
+  int exponent = 0;
+  std::from_chars(*(ptr + 1) == '+' ? ptr + 2 : ptr + 1, end, exponent);
+
+  const auto digits_view = std::string_view(digits, num_digits);
+
+  const int point = exponent + 1;
+
+  if (point > 21 || point <= -6) {
+    buffer_->push_back(digits[0]);
+    if (num_digits > 1) {
+      buffer_->push_back('.');
+      buffer_->append(digits_view.substr(1));
+    }
+    buffer_->push_back('e');
+    write_integer(exponent);
+  } else if (point >= num_digits) {
+    buffer_->append(digits_view);
+    buffer_->append(point - num_digits, '0');
+    buffer_->append(".0");
+  } else if (point > 0) {
+    buffer_->append(digits_view.substr(0, point));
+    buffer_->push_back('.');
+    buffer_->append(digits_view.substr(point));
+  } else {
+    buffer_->append("0.");
+    buffer_->append(-point, '0');
+    buffer_->append(digits_view);
+  }
+}
+
+void DirectWriter::write_key(const std::string_view _name) const noexcept {
+  write_string(_name);
+  if (pretty_) {
+    buffer_->append(": ");
+  } else {
+    buffer_->push_back(':');
+  }
+}
+
+void DirectWriter::write_string(const std::string_view _str) const noexcept {
+  constexpr std::string_view hex = "0123456789ABCDEF";
+  buffer_->push_back('"');
+  size_t begin = 0;
+  for (size_t i = 0; i < _str.size(); ++i) {
+    const auto c = static_cast<unsigned char>(_str[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') [[likely]] {
+      continue;
+    }
+    buffer_->append(_str.substr(begin, i - begin));
+    begin = i + 1;
+    switch (c) {
+      case '"':
+        buffer_->append("\\\"");
+        break;
+      case '\\':
+        buffer_->append("\\\\");
+        break;
+      case '\b':
+        buffer_->append("\\b");
+        break;
+      case '\f':
+        buffer_->append("\\f");
+        break;
+      case '\n':
+        buffer_->append("\\n");
+        break;
+      case '\r':
+        buffer_->append("\\r");
+        break;
+      case '\t':
+        buffer_->append("\\t");
+        break;
+      default:
+        buffer_->append("\\u00");
+        buffer_->push_back(hex[c >> 4]);
+        buffer_->push_back(hex[c & 0xF]);
+        break;
+    }
+  }
+  buffer_->append(_str.substr(begin));
+  buffer_->push_back('"');
+}
+
+}  // namespace rfl::json
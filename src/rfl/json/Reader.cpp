@@ -46,10 +46,31 @@ rfl::Result<Reader::InputVarType> Reader::get_field_from_object(
   return var;
 }
 
+std::optional<std::pair<std::string_view, Reader::InputVarType>>
+Reader::get_first_field(const InputObjectType _obj) const noexcept {
+  yyjson_obj_iter iter;
+  yyjson_obj_iter_init(_obj.val_, &iter);
+  yyjson_val* key = yyjson_obj_iter_next(&iter);
+  if (!key) {
+    return std::nullopt;
+  }
+  return std::make_pair(
+      std::string_view(yyjson_get_str(key), yyjson_get_len(key)),
+      InputVarType(yyjson_obj_iter_get_val(key)));
+}
+
 bool Reader::is_empty(const InputVarType _var) const noexcept {
   return !_var.val_ || yyjson_is_null(_var.val_);
 }
 
+size_t Reader::size_hint(const InputArrayType _arr) const noexcept {
+  return yyjson_arr_size(_arr.val_);
+}
+
+size_t Reader::size_hint(const InputObjectType _obj) const noexcept {
+  return yyjson_obj_size(_obj.val_);
+}
+
 rfl::Result<Reader::InputArrayType> Reader::to_array(
     const InputVarType _var) const noexcept {
   if (!yyjson_is_arr(_var.val_)) {
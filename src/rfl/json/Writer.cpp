@@ -63,6 +63,14 @@ Writer::OutputArrayType Writer::add_array_to_object(
   return OutputArrayType(arr);
 }
 
+Writer::OutputArrayType Writer::add_array_to_object(
+    const parsing::KeyToken& _key, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  const auto arr = yyjson_mut_arr(doc_);
+  yyjson_mut_obj_add(_parent->val_, key_to_yyjson(_key), arr);
+  return OutputArrayType(arr);
+}
+
 Writer::OutputObjectType Writer::add_object_to_array(
     const size_t, OutputArrayType* _parent) const noexcept {
   const auto obj = yyjson_mut_obj(doc_);
@@ -78,6 +86,14 @@ Writer::OutputObjectType Writer::add_object_to_object(
   return OutputObjectType(obj);
 }
 
+Writer::OutputObjectType Writer::add_object_to_object(
+    const parsing::KeyToken& _key, const size_t,
+    OutputObjectType* _parent) const noexcept {
+  const auto obj = yyjson_mut_obj(doc_);
+  yyjson_mut_obj_add(_parent->val_, key_to_yyjson(_key), obj);
+  return OutputObjectType(obj);
+}
+
 Writer::OutputVarType Writer::add_null_to_array(
     OutputArrayType* _parent) const noexcept {
   const auto null = yyjson_mut_null(doc_);
@@ -93,6 +109,13 @@ Writer::OutputVarType Writer::add_null_to_object(
   return OutputVarType(null);
 }
 
+Writer::OutputVarType Writer::add_null_to_object(
+    const parsing::KeyToken& _key, OutputObjectType* _parent) const noexcept {
+  const auto null = yyjson_mut_null(doc_);
+  yyjson_mut_obj_add(_parent->val_, key_to_yyjson(_key), null);
+  return OutputVarType(null);
+}
+
 void Writer::end_array(OutputArrayType*) const noexcept {}
 
 void Writer::end_object(OutputObjectType*) const noexcept {}
@@ -27,10 +27,28 @@ rfl::Result<Reader::InputVarType> Reader::get_field_from_object(
   return Error("No field named '" + _name + "' was found.");
 }
 
+std::optional<std::pair<std::string_view, Reader::InputVarType>>
+Reader::get_first_field(const InputObjectType& _obj) const noexcept {
+  if (_obj.size == 0 || _obj.ptr[0].key.type != MSGPACK_OBJECT_STR) {
+    return std::nullopt;
+  }
+  const auto& key = _obj.ptr[0].key;
+  return std::make_pair(std::string_view(key.via.str.ptr, key.via.str.size),
+                        _obj.ptr[0].val);
+}
+
 bool Reader::is_empty(const InputVarType& _var) const noexcept {
   return _var.type == MSGPACK_OBJECT_NIL;
 }
 
+size_t Reader::size_hint(const InputArrayType& _arr) const noexcept {
+  return _arr.size;
+}
+
+size_t Reader::size_hint(const InputObjectType& _obj) const noexcept {
+  return _obj.size;
+}
+
 rfl::Result<Reader::InputArrayType> Reader::to_array(
     const InputVarType& _var) const noexcept {
   if (_var.type != MSGPACK_OBJECT_ARRAY) {
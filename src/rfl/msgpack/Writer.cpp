@@ -34,6 +34,13 @@ Writer::OutputArrayType Writer::add_array_to_object(
   return new_array(_size);
 }
 
+Writer::OutputArrayType Writer::add_array_to_object(
+    const parsing::KeyToken& _key, const size_t _size,
+    OutputObjectType* _parent) const noexcept {
+  add_key(_key);
+  return new_array(_size);
+}
+
 Writer::OutputObjectType Writer::add_object_to_array(
     const size_t _size, OutputArrayType* _parent) const noexcept {
   return new_object(_size);
@@ -47,6 +54,13 @@ Writer::OutputObjectType Writer::add_object_to_object(
   return new_object(_size);
 }
 
+Writer::OutputObjectType Writer::add_object_to_object(
+    const parsing::KeyToken& _key, const size_t _size,
+    OutputObjectType* _parent) const noexcept {
+  add_key(_key);
+  return new_object(_size);
+}
+
 Writer::OutputVarType Writer::add_null_to_array(
     OutputArrayType* _parent) const noexcept {
   msgpack_pack_nil(pk_);
@@ -61,6 +75,13 @@ Writer::OutputVarType Writer::add_null_to_object(
   return OutputVarType{};
 }
 
+Writer::OutputVarType Writer::add_null_to_object(
+    const parsing::KeyToken& _key, OutputObjectType* _parent) const noexcept {
+  add_key(_key);
+  msgpack_pack_nil(pk_);
+  return OutputVarType{};
+}
+
 void Writer::end_array(OutputArrayType* _arr) const noexcept {}
 
 void Writer::end_object(OutputObjectType* _obj) const noexcept {}
@@ -0,0 +1,38 @@
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/cbor.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_indefinite_length {
+
+struct Person {
+  std::string first_name;
+  std::vector<int> ids;
+  std::vector<Person> children;
+};
+
+TEST(cbor, test_indefinite_length) {
+  // {_ "first_name": "Homer", "ids": [_ 1, 2, 3], "children": [_ {_
+  //  "first_name": "Bart", "ids": [], "children": []}]}
+  const auto bytes = std::vector<uint8_t>(
+      {0xbf, 0x6a, 'f', 'i', 'r', 's', 't', '_', 'n', 'a', 'm', 'e', 0x65, 'H',
+       'o', 'm', 'e', 'r', 0x63, 'i', 'd', 's', 0x9f, 0x01, 0x02, 0x03, 0xff,
+       0x68, 'c', 'h', 'i', 'l', 'd', 'r', 'e', 'n', 0x9f, 0xbf, 0x6a, 'f',
+       'i', 'r', 's', 't', '_', 'n', 'a', 'm', 'e', 0x64, 'B', 'a', 'r', 't',
+       0x63, 'i', 'd', 's', 0x80, 0x68, 'c', 'h', 'i', 'l', 'd', 'r', 'e', 'n',
+       0x80, 0xff, 0xff, 0xff});
+
+  const auto res = rfl::cbor::read<Person>(
+      reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(res.value().first_name, "Homer");
+  EXPECT_EQ(res.value().ids, std::vector<int>({1, 2, 3}));
+  ASSERT_EQ(res.value().children.size(), 1u);
+  EXPECT_EQ(res.value().children[0].first_name, "Bart");
+}
+}  // namespace test_indefinite_length
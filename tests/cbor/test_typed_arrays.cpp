@@ -0,0 +1,73 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/cbor.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_typed_arrays {
+
+struct Measurement {
+  std::string sensor;
+  std::vector<float> values;
+  std::vector<std::uint8_t> flags;
+  std::array<std::int32_t, 3> position;
+  std::vector<double> empty;
+  std::array<std::int16_t, 0> empty_array;
+};
+
+TEST(cbor, test_typed_arrays) {
+  const auto measurement =
+      Measurement{.sensor = "thermometer",
+                  .values = {20.5f, 21.0f, 21.25f, -3.75f},
+                  .flags = {0, 1, 255},
+                  .position = {1, -2, 70000},
+                  .empty = {},
+                  .empty_array = {}};
+
+  write_and_read<rfl::cbor::TypedArrays>(measurement);
+
+  const auto typed = rfl::cbor::write<rfl::cbor::TypedArrays>(measurement);
+  const auto plain = rfl::cbor::write(measurement);
+  EXPECT_LT(typed.size(), plain.size());
+
+  // Typed arrays can always be read, whether the processor is passed or not.
+  const auto res = rfl::cbor::read<Measurement>(typed);
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(res.value().values, measurement.values);
+  EXPECT_EQ(res.value().flags, measurement.flags);
+  EXPECT_EQ(res.value().position, measurement.position);
+  EXPECT_TRUE(res.value().empty.empty());
+
+  // An empty typed array can also be read into containers that are not
+  // read in bulk.
+  const auto empty = rfl::cbor::write<rfl::cbor::TypedArrays>(
+      std::vector<double>());
+  const auto res_empty = rfl::cbor::read<std::vector<std::string>>(empty);
+  EXPECT_TRUE(res_empty && true) << res_empty.error()->what();
+  EXPECT_TRUE(res_empty.value().empty());
+}
+
+TEST(cbor, test_typed_arrays_big_endian) {
+  // 81([1.0, 2.5]), which is a typed array of big-endian float32.
+  const auto bytes = std::vector<uint8_t>({0xd8, 0x51, 0x48, 0x3f, 0x80, 0x00,
+                                           0x00, 0x40, 0x20, 0x00, 0x00});
+
+  const auto res1 = rfl::cbor::read<std::vector<float>>(
+      reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  EXPECT_TRUE(res1 && true) << res1.error()->what();
+  EXPECT_EQ(res1.value(), std::vector<float>({1.0f, 2.5f}));
+
+  const auto res2 = rfl::cbor::read<std::array<double, 2>>(
+      reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  EXPECT_TRUE(res2 && true) << res2.error()->what();
+  EXPECT_EQ(res2.value(), (std::array<double, 2>({1.0, 2.5})));
+
+  const auto res3 = rfl::cbor::read<std::array<double, 3>>(
+      reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  EXPECT_FALSE(res3 && true);
+}
+}  // namespace test_typed_arrays
@@ -0,0 +1,50 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_typed_vectors {
+
+struct Numbers {
+  std::vector<double> doubles;
+  std::vector<int32_t> ints;
+  std::vector<uint8_t> bytes;
+  std::array<float, 3> floats;
+};
+
+struct View {
+  std::span<const double> doubles;
+  std::span<const int32_t> ints;
+};
+
+TEST(flexbuf, test_typed_vectors) {
+  const auto numbers = Numbers{.doubles = {1.5, -2.25, 3.0},
+                               .ints = {-1, 2, 3},
+                               .bytes = std::vector<uint8_t>(300, 7),
+                               .floats = {1.0f, 2.5f, -3.0f}};
+
+  write_and_read(numbers);
+
+  const auto bytes = rfl::flexbuf::write(numbers);
+
+  const auto res = rfl::flexbuf::read_borrowed<View>(bytes);
+
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(std::vector<double>(res.value()->doubles.begin(),
+                                res.value()->doubles.end()),
+            numbers.doubles);
+  EXPECT_EQ(std::vector<int32_t>(res.value()->ints.begin(),
+                                 res.value()->ints.end()),
+            numbers.ints);
+
+  // The view must point into the buffer rather than to a copy.
+  const auto ptr = reinterpret_cast<const char*>(res.value()->doubles.data());
+  EXPECT_TRUE(ptr >= bytes.data() && ptr < bytes.data() + bytes.size());
+}
+}  // namespace test_typed_vectors
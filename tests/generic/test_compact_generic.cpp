@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace test_compact_generic {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int64_t id;
+  double height;
+  bool is_child;
+  std::optional<std::string> email;
+  std::vector<Person> children;
+};
+
+TEST(generic, test_compact_generic) {
+  const auto homer = Person{
+      .first_name = "Homer",
+      .id = 10000000000,
+      .height = 1.83,
+      .is_child = false,
+      .email = "homer.j.simpson@springfield-nuclear.com",
+      .children = {Person{.first_name = "Bart", .id = 1, .height = 1.2,
+                          .is_child = true},
+                   Person{.first_name = "Lisa", .id = 2, .height = 1.1,
+                          .is_child = true}}};
+
+  const auto json_string = rfl::json::write(homer);
+
+  const auto compact = rfl::to_compact_generic(homer);
+  EXPECT_EQ(rfl::json::write(compact), json_string);
+
+  const auto res = rfl::from_generic<Person>(compact);
+  ASSERT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(rfl::json::write(*res), json_string);
+
+  const auto parsed = rfl::json::read<rfl::CompactGeneric>(json_string);
+  ASSERT_TRUE(parsed && true) << parsed.error()->what();
+  EXPECT_EQ(rfl::json::write(*parsed), json_string);
+
+  const auto& root = parsed.value().get();
+  ASSERT_EQ(root.type(), rfl::CompactGeneric::Type::object);
+  EXPECT_EQ(root.find("id")->to_int().value(), 10000000000);
+  EXPECT_EQ(root.find("first_name")->to_string_view().value(), "Homer");
+  EXPECT_EQ(root.find("email")->to_string().value(),
+            "homer.j.simpson@springfield-nuclear.com");
+  EXPECT_EQ(root.find("children")->to_array().value().size(), 2u);
+  EXPECT_EQ(root.find("does_not_exist"), nullptr);
+
+  const auto copy = *parsed;
+  EXPECT_EQ(rfl::json::write(copy), json_string);
+
+  const auto generic = rfl::json::read<rfl::Generic>(
+      R"({"a":[1,2.5,"a longer string",null,true],"b":{"c":"d"}})");
+  ASSERT_TRUE(generic && true) << generic.error()->what();
+  const auto from_generic = rfl::CompactGeneric(*generic);
+  EXPECT_EQ(rfl::json::write(from_generic), rfl::json::write(*generic));
+  EXPECT_EQ(rfl::json::write(from_generic.to_generic()),
+            rfl::json::write(*generic));
+}
+
+}  // namespace test_compact_generic
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_assume_ordered_fields {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  std::string town = "Springfield";
+  int age;
+  std::vector<Person> children;
+};
+
+TEST(json, test_assume_ordered_fields) {
+  const auto bart = Person{.first_name = "Bart", .age = 10};
+
+  const auto homer = Person{
+      .first_name = "Homer", .age = 45, .children = std::vector<Person>({bart})};
+
+  write_and_read<rfl::AssumeOrderedFields>(
+      homer,
+      R"({"first_name":"Homer","last_name":"Simpson","town":"Springfield","age":45,"children":[{"first_name":"Bart","last_name":"Simpson","town":"Springfield","age":10,"children":[]}]})");
+
+  const auto shuffled =
+      rfl::json::read<Person, rfl::AssumeOrderedFields>(
+          R"({"age":10,"town":"Springfield","children":[],"last_name":"Simpson","first_name":"Lisa"})")
+          .value();
+
+  EXPECT_EQ(shuffled.first_name, "Lisa");
+  EXPECT_EQ(shuffled.age, 10);
+
+  const auto with_default =
+      rfl::json::read<Person, rfl::AssumeOrderedFields, rfl::DefaultIfMissing>(
+          R"({"first_name":"Maggie","extra":1,"age":0})")
+          .value();
+
+  EXPECT_EQ(with_default.first_name, "Maggie");
+  EXPECT_EQ(with_default.last_name, "Simpson");
+  EXPECT_EQ(with_default.age, 0);
+}
+}  // namespace test_assume_ordered_fields
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_context {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  std::vector<Person> children;
+};
+
+TEST(json, test_context) {
+  auto ctx = rfl::json::Context(256);
+
+  const auto bart = Person{.first_name = "Bart"};
+
+  const auto lisa = Person{.first_name = "Lisa"};
+
+  const auto maggie = Person{.first_name = "Maggie"};
+
+  const auto homer =
+      Person{.first_name = "Homer",
+             .children = std::vector<Person>({bart, lisa, maggie})};
+
+  // Large enough to require the context to grow.
+  auto family = Person{.first_name = "Abraham"};
+  for (int i = 0; i < 1000; ++i) {
+    family.children.push_back(homer);
+  }
+
+  const auto expected = rfl::json::write(homer);
+
+  for (int i = 0; i < 3; ++i) {
+    const auto json_string = rfl::json::write(homer, ctx);
+    EXPECT_EQ(json_string, expected);
+
+    const auto res = rfl::json::read<Person>(json_string, ctx);
+    EXPECT_TRUE(res && true) << "Test failed on read. Error: "
+                             << res.error().value().what();
+    EXPECT_EQ(rfl::json::write(res.value(), ctx), expected);
+
+    const auto large = rfl::json::write(family, ctx);
+    EXPECT_EQ(large, rfl::json::write(family));
+
+    const auto res2 = rfl::json::read<Person>(large, ctx);
+    EXPECT_TRUE(res2 && true) << "Test failed on read. Error: "
+                              << res2.error().value().what();
+    EXPECT_EQ(res2.value().children.size(), 1000u);
+  }
+
+  EXPECT_TRUE(ctx.capacity() > 256);
+}
+}  // namespace test_context
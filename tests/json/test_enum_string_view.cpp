@@ -0,0 +1,65 @@
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <string_view>
+
+#include "write_and_read.hpp"
+
+namespace test_enum_string_view {
+
+enum class Color { red, green, blue, yellow };
+
+enum class Flag : unsigned char { a = 1, b = 2, c = 8 };
+
+inline Flag operator|(Flag f1, Flag f2) {
+  return static_cast<Flag>(static_cast<unsigned char>(f1) |
+                           static_cast<unsigned char>(f2));
+}
+
+struct Circle {
+  Color color;
+  Flag flags;
+};
+
+TEST(json, test_enum_string_view) {
+  static_assert(rfl::enum_to_string_view(Color::blue) == "blue");
+  EXPECT_EQ(rfl::enum_to_string_view(static_cast<Color>(42)), std::nullopt);
+  EXPECT_EQ(rfl::enum_to_string_view(Flag::c), "c");
+  EXPECT_EQ(rfl::enum_to_string_view(Flag::a | Flag::b), std::nullopt);
+
+  EXPECT_EQ(rfl::enum_to_string(static_cast<Color>(42)), "42");
+  EXPECT_EQ(rfl::enum_to_string(Flag::a | Flag::c), "a|c");
+  EXPECT_EQ(rfl::enum_to_string(static_cast<Flag>(255)),
+            "a|b|4|c|16|32|64|128");
+
+  EXPECT_EQ(rfl::string_to_enum<Color>("yellow").value(), Color::yellow);
+  EXPECT_EQ(rfl::string_to_enum<Color>("42").value(), static_cast<Color>(42));
+  EXPECT_EQ(rfl::string_to_enum<Flag>("c|a|4").value(),
+            static_cast<Flag>(13));
+
+  const auto err = rfl::string_to_enum<Color>("purple");
+  ASSERT_FALSE(err && true);
+  EXPECT_EQ(err.error().value().what(),
+            std::string("Could not convert 'purple' to an enum. The following "
+                        "values are allowed: red, green, blue, yellow."));
+  EXPECT_FALSE(rfl::string_to_enum<Flag>("a|d") && true);
+
+  write_and_read(Circle{.color = Color::green, .flags = Flag::b | Flag::c},
+                 R"({"color":"green","flags":"b|c"})");
+
+  // Enums are written as string views, either pointing to the names or into
+  // a buffer on the stack.
+  const auto unknown =
+      Circle{.color = static_cast<Color>(42), .flags = static_cast<Flag>(255)};
+  const auto expected =
+      std::string(R"({"color":"42","flags":"a|b|4|c|16|32|64|128"})");
+  EXPECT_EQ(rfl::json::write(unknown), expected);
+  EXPECT_EQ(rfl::json::write_direct(unknown), expected);
+  EXPECT_EQ(rfl::json::write(Color::blue), "\"blue\"");
+  EXPECT_EQ(rfl::json::write(std::vector<Color>({Color::red, Color::yellow})),
+            R"(["red","yellow"])");
+  EXPECT_EQ(rfl::json::write(rfl::to_compact_generic(unknown)), expected);
+}
+
+}  // namespace test_enum_string_view
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace test_fail_fast {
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  rfl::Rename<"lastName", std::string> last_name;
+  rfl::Timestamp<"%Y-%m-%d"> birthday;
+  std::vector<Person> children;
+};
+
+struct Family {
+  std::map<std::string, Person> members;
+};
+
+TEST(json, test_fail_fast) {
+  const std::string faulty_string =
+      R"({"firstName":"Homer","lastName":12345,"birthday":"04/19/1987"})";
+
+  const auto result = rfl::json::read<Person, rfl::FailFast>(faulty_string);
+
+  EXPECT_TRUE(result.error() && true);
+
+  EXPECT_EQ(result.error().value().what(),
+            "Failed to parse field 'lastName': Could not cast to string.");
+}
+
+TEST(json, test_fail_fast_nested) {
+  const std::string faulty_string =
+      R"({"members":{"homer":{"firstName":"Homer","lastName":"Simpson",)"
+      R"("birthday":"1987-04-19","children":[{"firstName":"Bart",)"
+      R"("lastName":"Simpson","birthday":"1987-04-19","children":[1]}]}}})";
+
+  const auto result1 = rfl::json::read<Family>(faulty_string);
+  const auto result2 = rfl::json::read<Family, rfl::FailFast>(faulty_string);
+
+  EXPECT_TRUE(result1.error() && true);
+  EXPECT_TRUE(result2.error() && true);
+
+  // There is only a single error, so the messages must be identical.
+  EXPECT_EQ(result1.error().value().what(), result2.error().value().what());
+
+  // The message is put together lazily, which must be safe from several
+  // threads and must survive copies.
+  const auto err = result2.error().value();
+  const auto expected = result1.error().value().what();
+  std::vector<std::thread> threads;
+  std::vector<int> matches(4, 0);
+  for (size_t t = 0; t < matches.size(); ++t) {
+    threads.emplace_back([&, t]() { matches[t] = (err.what() == expected); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (const int m : matches) {
+    EXPECT_TRUE(m);
+  }
+  const auto copy = err;
+  EXPECT_EQ(copy.what(), expected);
+}
+
+TEST(json, test_fail_fast_variant) {
+  const auto result =
+      rfl::json::read<std::variant<Person, int>, rfl::FailFast>("\"Homer\"");
+
+  EXPECT_TRUE(result.error() && true);
+
+  EXPECT_EQ(result.error().value().what(),
+            "Could not parse the variant. None of the alternatives matched.");
+}
+}  // namespace test_fail_fast
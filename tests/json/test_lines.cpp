@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_lines {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int age;
+};
+
+TEST(json, test_lines) {
+  const auto people =
+      std::vector<Person>({Person{.first_name = "Homer", .age = 45},
+                           Person{.first_name = "Marge", .age = 42},
+                           Person{.first_name = "Bart", .age = 10}});
+
+  const auto json_lines = rfl::json::write_lines(people);
+
+  EXPECT_EQ(json_lines,
+            R"({"first_name":"Homer","last_name":"Simpson","age":45}
+{"first_name":"Marge","last_name":"Simpson","age":42}
+{"first_name":"Bart","last_name":"Simpson","age":10}
+)");
+
+  auto stream = std::stringstream();
+  rfl::json::write_lines(people, stream);
+  EXPECT_EQ(stream.str(), json_lines);
+
+  // Empty lines and Windows line endings are fine.
+  auto input = std::stringstream(
+      "\n" + json_lines +
+      "\r\n  \n"
+      "{\"first_name\":\"Lisa\",\"last_name\":\"Simpson\",\"age\":8}\r\n");
+
+  auto names = std::vector<std::string>();
+  for (const auto& res : rfl::json::read_lines<Person>(input)) {
+    EXPECT_TRUE(res && true) << "Test failed on read. Error: "
+                             << res.error().value().what();
+    names.push_back(res.value().first_name);
+  }
+  EXPECT_EQ(names,
+            std::vector<std::string>({"Homer", "Marge", "Bart", "Lisa"}));
+}
+
+TEST(json, test_lines_errors) {
+  auto input = std::stringstream(
+      "{\"first_name\":\"Homer\",\"last_name\":\"Simpson\",\"age\":45}\n"
+      "{\"first_name\":\"Marge\",\n"
+      "{\"first_name\":\"Bart\",\"last_name\":\"Simpson\",\"age\":10}\n");
+
+  auto lines = rfl::json::read_lines<Person>(input);
+  auto it = lines.begin();
+  ASSERT_TRUE(it != lines.end());
+  EXPECT_TRUE(*it && true);
+  ++it;
+  ASSERT_TRUE(it != lines.end());
+  EXPECT_FALSE(*it && true);
+  EXPECT_EQ(it->error().value().what(), "Line 2: Could not parse document");
+  ++it;
+  ASSERT_TRUE(it != lines.end());
+  EXPECT_EQ((*it).value().first_name, "Bart");
+  ++it;
+  EXPECT_TRUE(it == lines.end());
+}
+
+TEST(json, test_load_lines) {
+  const auto people =
+      std::vector<Person>(1000, Person{.first_name = "Homer", .age = 45});
+
+  const auto fname = std::string("test_load_lines.jsonl");
+  {
+    auto outfile = std::ofstream(fname);
+    rfl::json::write_lines(people, outfile);
+  }
+
+  auto lines = rfl::json::load_lines<Person>(fname);
+  ASSERT_TRUE(lines && true) << lines.error().value().what();
+
+  size_t count = 0;
+  for (auto& res : lines.value()) {
+    EXPECT_EQ(res.value().first_name, "Homer");
+    ++count;
+  }
+  EXPECT_EQ(count, 1000u);
+
+  std::remove(fname.c_str());
+
+  EXPECT_FALSE(rfl::json::load_lines<Person>("does_not_exist.jsonl") && true);
+}
+}  // namespace test_lines
@@ -0,0 +1,89 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/io/load_string.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include "write_and_read.hpp"
+
+namespace test_load_mapped {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  std::vector<Person> children;
+};
+
+TEST(json, test_load_mapped) {
+  const auto homer = Person{
+      .first_name = "Homer",
+      .children = std::vector<Person>(2, Person{.first_name = "Bart"})};
+
+  const std::string expected =
+      R"({"first_name":"Homer","last_name":"Simpson","children":[{"first_name":"Bart","last_name":"Simpson","children":[]},{"first_name":"Bart","last_name":"Simpson","children":[]}]})";
+
+  write_and_read(homer, expected);
+
+  rfl::json::save("test_load_mapped.json", homer);
+
+  const auto res = rfl::json::load<Person>("test_load_mapped.json");
+  EXPECT_TRUE(res && true) << res.error().value().what();
+  EXPECT_EQ(rfl::json::write(res.value()), expected);
+
+  const auto file = rfl::io::MappedFile::open("test_load_mapped.json");
+  EXPECT_TRUE(file && true);
+  EXPECT_EQ(file.value().view(), expected);
+
+  std::remove("test_load_mapped.json");
+
+  { std::ofstream("test_load_mapped_empty.json"); }
+
+  EXPECT_EQ(rfl::io::MappedFile::open("test_load_mapped_empty.json")
+                .value()
+                .size(),
+            0u);
+  EXPECT_FALSE(rfl::json::load<Person>("test_load_mapped_empty.json") && true);
+
+  std::remove("test_load_mapped_empty.json");
+
+  EXPECT_FALSE(rfl::json::load<Person>("does_not_exist.json") && true);
+}
+
+#ifndef _WIN32
+TEST(json, test_load_mapped_from_fifo) {
+  // A FIFO reports a size of zero and cannot be mapped, so it must be read.
+  const auto homer = Person{.first_name = "Homer"};
+
+  std::remove("test_load_mapped.fifo");
+  ASSERT_EQ(mkfifo("test_load_mapped.fifo", 0600), 0);
+
+  const auto write_to_fifo = [&]() {
+    std::ofstream("test_load_mapped.fifo") << rfl::json::write(homer);
+  };
+
+  auto writer = std::thread(write_to_fifo);
+  const auto res = rfl::json::load<Person>("test_load_mapped.fifo");
+  writer.join();
+
+  EXPECT_TRUE(res && true) << res.error().value().what();
+  EXPECT_EQ(rfl::json::write(res.value()), rfl::json::write(homer));
+
+  writer = std::thread(write_to_fifo);
+  const auto str = rfl::io::load_string("test_load_mapped.fifo");
+  writer.join();
+
+  EXPECT_EQ(str.value(), rfl::json::write(homer));
+
+  std::remove("test_load_mapped.fifo");
+}
+#endif
+
+}  // namespace test_load_mapped
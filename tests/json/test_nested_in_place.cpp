@@ -0,0 +1,50 @@
+#include <array>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_nested_in_place {
+
+struct Point {
+  std::string label;
+  std::array<double, 3> coordinates;
+};
+
+struct Segment {
+  Point from;
+  Point to;
+};
+
+struct Path {
+  std::string name;
+  std::array<Segment, 2> segments;
+  rfl::Tuple<Point, std::string> end;
+  std::vector<std::string> tags;
+};
+
+TEST(json, test_nested_in_place) {
+  const auto path = Path{
+      .name = "path",
+      .segments = {Segment{.from = Point{"a", {0.0, 0.0, 0.0}},
+                           .to = Point{"b", {1.0, 0.0, 0.0}}},
+                   Segment{.from = Point{"b", {1.0, 0.0, 0.0}},
+                           .to = Point{"c", {1.0, 1.0, 0.0}}}},
+      .end = rfl::Tuple<Point, std::string>(Point{"c", {1.0, 1.0, 0.0}},
+                                            "end"),
+      .tags = {"x", "y"}};
+
+  write_and_read(
+      path,
+      R"({"name":"path","segments":[{"from":{"label":"a","coordinates":[0.0,0.0,0.0]},"to":{"label":"b","coordinates":[1.0,0.0,0.0]}},{"from":{"label":"b","coordinates":[1.0,0.0,0.0]},"to":{"label":"c","coordinates":[1.0,1.0,0.0]}}],"end":[{"label":"c","coordinates":[1.0,1.0,0.0]},"end"],"tags":["x","y"]})");
+
+  // The nested structs are partially constructed when the errors occur, so
+  // this makes sure that they are cleaned up properly.
+  const auto res = rfl::json::read<Path>(
+      R"({"name":"path","segments":[{"from":{"label":"a","coordinates":[0.0,0.0,0.0]},"to":{"label":"b"}}],"end":[{"label":"c","coordinates":[1.0,1.0,0.0]}],"tags":["x","y"]})");
+  EXPECT_FALSE(res && true);
+}
+
+}  // namespace test_nested_in_place
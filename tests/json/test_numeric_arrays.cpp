@@ -0,0 +1,51 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_numeric_arrays {
+
+struct Numbers {
+  std::vector<double> doubles;
+  std::vector<int64_t> ints;
+  std::vector<uint8_t> bytes;
+  std::array<float, 3> floats;
+  std::array<std::array<int, 3>, 2> matrix;
+};
+
+TEST(json, test_numeric_arrays) {
+  const auto numbers = Numbers{.doubles = {1.5, -2.25, 3.0},
+                               .ints = {-1, 2, 9007199254740993},
+                               .bytes = {0, 127, 255},
+                               .floats = {1.0f, 2.5f, -3.0f},
+                               .matrix = {{{1, 2, 3}, {4, 5, 6}}}};
+
+  write_and_read(
+      numbers,
+      R"({"doubles":[1.5,-2.25,3.0],"ints":[-1,2,9007199254740993],"bytes":[0,127,255],"floats":[1.0,2.5,-3.0],"matrix":[[1,2,3],[4,5,6]]})");
+
+  const auto res = rfl::json::read<std::vector<double>>("[1,2.5,-3]");
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(res.value(), std::vector<double>({1.0, 2.5, -3.0}));
+}
+
+TEST(json, test_numeric_arrays_errors) {
+  const auto res1 = rfl::json::read<std::vector<int>>(R"([1,2.5,3])");
+  EXPECT_FALSE(res1 && true);
+  EXPECT_EQ(res1.error()->what(), std::string("Could not cast to int."));
+
+  const auto res2 = rfl::json::read<std::array<double, 3>>(R"([1,2])");
+  EXPECT_FALSE(res2 && true);
+  EXPECT_EQ(res2.error()->what(), std::string("Expected 3 elements, got 2."));
+
+  const auto res3 = rfl::json::read<std::array<double, 2>>(R"([1,"a"])");
+  EXPECT_FALSE(res3 && true);
+  EXPECT_EQ(res3.error()->what(),
+            std::string("Failed to parse element 1: Could not cast to double."));
+}
+}  // namespace test_numeric_arrays
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_object_index {
+
+TEST(json, test_object_index) {
+  constexpr int num_fields = 1000;
+
+  rfl::Object<int> o;
+  for (int i = 0; i < num_fields; ++i) {
+    o["field_" + std::to_string(i)] = i;
+  }
+  o.insert(std::string("field_0"), 42);
+
+  EXPECT_EQ(o.size(), static_cast<size_t>(num_fields + 1));
+  EXPECT_EQ(o.begin()->first, "field_0");
+  EXPECT_EQ(o.rbegin()->second, 42);
+
+  // Duplicate keys resolve to the first field, just like for small objects.
+  EXPECT_EQ(o.at("field_0"), 0);
+  EXPECT_FALSE(o.get("does_not_exist") && true);
+
+  const auto& shared = o;
+  std::vector<std::thread> threads;
+  std::vector<int> num_found(4, 0);
+  for (size_t t = 0; t < num_found.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < num_fields; ++i) {
+        if (shared.at("field_" + std::to_string(i)) == i) {
+          ++num_found[t];
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (const auto n : num_found) {
+    EXPECT_EQ(n, num_fields);
+  }
+
+  for (auto& [k, v] : o) {
+    if (k == "field_1") {
+      k = "renamed";
+    }
+  }
+  EXPECT_EQ(o.at("renamed"), 1);
+  EXPECT_FALSE(o.get("field_1") && true);
+
+  // Iterators that were handed out before the index was rebuilt can still
+  // rename keys.
+  auto it = o.begin() + 2;
+  EXPECT_EQ(o.at("field_500"), 500);
+  it->first = "renamed_again";
+  EXPECT_EQ(o.at("renamed_again"), 2);
+  EXPECT_FALSE(o.get("field_2") && true);
+
+  const auto copy = o;
+  EXPECT_EQ(copy.at("field_999"), 999);
+
+  auto moved = std::move(o);
+  moved["field_1000"] = 1000;
+  EXPECT_EQ(moved.at("field_1000"), 1000);
+  EXPECT_EQ(moved.at("field_500"), 500);
+}
+
+TEST(json, test_object_index_concurrent_iteration) {
+  constexpr int num_fields = 1000;
+
+  rfl::Object<int> o;
+  for (int i = 0; i < num_fields; ++i) {
+    o["field_" + std::to_string(i)] = i;
+  }
+
+  // Non-const iteration and lookups may run at the same time, as long as
+  // nothing is modified.
+  std::vector<std::thread> threads;
+  std::vector<int> num_found(4, 0);
+  for (size_t t = 0; t < num_found.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < num_fields; ++i) {
+        if (t % 2 == 0) {
+          if (o.at("field_" + std::to_string(i)) == i) {
+            ++num_found[t];
+          }
+        } else {
+          int sum = 0;
+          for (auto& [k, v] : o) {
+            sum += v;
+          }
+          if (sum == num_fields * (num_fields - 1) / 2) {
+            ++num_found[t];
+          }
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (const auto n : num_found) {
+    EXPECT_EQ(n, num_fields);
+  }
+}
+
+}  // namespace test_object_index
@@ -0,0 +1,41 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_borrowed {
+
+struct Person {
+  std::string_view first_name;
+  std::string last_name;
+  std::vector<std::string_view> children;
+};
+
+TEST(json, test_read_borrowed) {
+  auto json_string = std::string(
+      R"({"first_name":"Homer","last_name":"Simpson","children":["Bart","Lisa","Maggie"]})");
+
+  const auto res = rfl::json::read_borrowed<Person>(json_string);
+
+  const auto& homer = res.value();
+
+  // The views point into the parsed document, not into the input.
+  json_string.assign(json_string.size(), 'x');
+
+  EXPECT_EQ(homer->first_name, "Homer");
+  EXPECT_EQ(homer->last_name, "Simpson");
+  EXPECT_EQ(homer->children.size(), 3u);
+  EXPECT_EQ(homer->children.at(2), "Maggie");
+
+  EXPECT_EQ(
+      rfl::json::write(*homer),
+      R"({"first_name":"Homer","last_name":"Simpson","children":["Bart","Lisa","Maggie"]})");
+
+  const auto err = rfl::json::read_borrowed<Person>(R"({"first_name":1})");
+  EXPECT_FALSE(err && true);
+}
+}  // namespace test_read_borrowed
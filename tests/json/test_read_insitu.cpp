@@ -0,0 +1,64 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_insitu {
+
+struct Person {
+  std::string first_name;
+  std::string last_name;
+  std::vector<Person> children;
+};
+
+struct Measurement {
+  std::string id;
+  double value;
+};
+
+TEST(json, test_read_insitu) {
+  const auto homer = Person{
+      .first_name = "Homer",
+      .last_name = "Simpson",
+      .children = std::vector<Person>({Person{.first_name = "Bart",
+                                              .last_name = "Simpson"}})};
+
+  auto buffer = rfl::json::write(homer);
+  buffer.resize(buffer.size() + rfl::json::insitu_padding);
+
+  const auto res = rfl::json::read_insitu<Person>(buffer);
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(rfl::json::write(res.value()), rfl::json::write(homer));
+
+  std::string too_small = "{}";
+  EXPECT_FALSE(rfl::json::read_insitu<Person>(too_small) && true);
+}
+
+TEST(json, test_read_options) {
+  const std::string json_string = R"({
+    // A comment.
+    "first_name": "Homer",
+    "last_name": "Simpson",
+    "children": [],
+  })";
+
+  EXPECT_FALSE(rfl::json::read<Person>(json_string) && true);
+
+  const auto opts = rfl::json::ReadOptions{.allow_comments = true,
+                                           .allow_trailing_commas = true};
+  const auto res = rfl::json::read<Person>(json_string, opts);
+  EXPECT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(res.value().first_name, "Homer");
+
+  const std::string big_number =
+      R"({"id":123456789012345678901234567890,"value":1.5})";
+  const auto m = rfl::json::read<Measurement>(
+      big_number, rfl::json::ReadOptions{.bignum_as_raw = true});
+  EXPECT_TRUE(m && true) << m.error()->what();
+  EXPECT_EQ(m.value().id, "123456789012345678901234567890");
+  EXPECT_EQ(m.value().value, 1.5);
+}
+}  // namespace test_read_insitu
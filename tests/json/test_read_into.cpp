@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace test_read_into {
+
+struct Address {
+  std::string street;
+  std::optional<std::string> city;
+};
+
+struct Person {
+  std::string first_name;
+  std::vector<int> scores;
+  std::vector<Address> addresses;
+  std::map<std::string, std::vector<std::string>> tags;
+  std::unordered_map<std::string, int> counts;
+  std::optional<Address> work;
+};
+
+TEST(json, test_read_into) {
+  const std::string long_json =
+      R"({"first_name":"Bartholomew Jojo Simpson","scores":[1,2,3,4,5],)"
+      R"("addresses":[{"street":"742 Evergreen Terrace","city":"Springfield"},)"
+      R"({"street":"Somewhere else"}],)"
+      R"("tags":{"a":["x","y"],"b":["z"]},"counts":{"a":1},)"
+      R"("work":{"street":"Power Plant"}})";
+
+  const std::string short_json =
+      R"({"first_name":"Bart","scores":[6],)"
+      R"("addresses":[{"street":"Main Street"}],)"
+      R"("tags":{"c":["w"]},"counts":{"b":3}})";
+
+  auto person = Person{};
+
+  ASSERT_TRUE(rfl::json::read_into(person, long_json) && true);
+  EXPECT_EQ(rfl::json::write(person), long_json);
+
+  const auto scores_data = person.scores.data();
+  const auto addresses_data = person.addresses.data();
+  const auto name_capacity = person.first_name.capacity();
+
+  ASSERT_TRUE(rfl::json::read_into(person, short_json) && true);
+  EXPECT_EQ(rfl::json::write(person), short_json);
+  EXPECT_EQ(rfl::json::write(person),
+            rfl::json::write(rfl::json::read<Person>(short_json).value()));
+
+  EXPECT_EQ(person.scores.data(), scores_data);
+  EXPECT_EQ(person.addresses.data(), addresses_data);
+  EXPECT_EQ(person.first_name.capacity(), name_capacity);
+
+  rfl::json::Context ctx;
+  ASSERT_TRUE(rfl::json::read_into(person, long_json, ctx) && true);
+  EXPECT_EQ(rfl::json::write(person), long_json);
+
+  const auto res = rfl::json::read_into(person, R"({"first_name":"Lisa"})");
+  ASSERT_FALSE(res && true);
+  EXPECT_EQ(res.error()->what(),
+            std::string("Found 4 errors:\n"
+                        "1) Field named 'scores' not found.\n"
+                        "2) Field named 'addresses' not found.\n"
+                        "3) Field named 'tags' not found.\n"
+                        "4) Field named 'counts' not found."));
+}
+
+struct Temperature {
+  double kelvin;
+};
+
+struct TemperatureImpl {
+  double celsius;
+
+  static TemperatureImpl from_class(const Temperature& _t) noexcept {
+    return TemperatureImpl{.celsius = _t.kelvin - 273.0};
+  }
+
+  Temperature to_class() const {
+    return Temperature{.kelvin = celsius + 273.0};
+  }
+};
+
+}  // namespace test_read_into
+
+namespace rfl {
+namespace parsing {
+
+template <class ReaderType, class WriterType, class ProcessorsType>
+struct Parser<ReaderType, WriterType, test_read_into::Temperature,
+              ProcessorsType>
+    : public CustomParser<ReaderType, WriterType, ProcessorsType,
+                          test_read_into::Temperature,
+                          test_read_into::TemperatureImpl> {};
+
+}  // namespace parsing
+}  // namespace rfl
+
+namespace test_read_into {
+
+TEST(json, test_read_into_custom_parser) {
+  // Temperature is an aggregate, but must still be read using its Parser.
+  auto temperature = Temperature{.kelvin = 0.0};
+
+  ASSERT_TRUE(rfl::json::read_into(temperature, R"({"celsius":20.0})") &&
+              true);
+  EXPECT_EQ(temperature.kelvin, 293.0);
+
+  EXPECT_FALSE(rfl::json::read_into(temperature, R"({"kelvin":20.0})") &&
+               true);
+}
+
+}  // namespace test_read_into
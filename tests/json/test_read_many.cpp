@@ -0,0 +1,63 @@
+#include <iostream>
+#include <memory>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_many {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int age;
+};
+
+TEST(json, test_read_many) {
+  const auto broken = std::string("{\"first_name\":\"Broken\"");
+  auto docs = std::vector<std::string>();
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 100 == 99) {
+      docs.push_back(broken);
+    } else {
+      docs.push_back(rfl::json::write(
+          Person{.first_name = "Person" + std::to_string(i), .age = i}));
+    }
+  }
+
+  const auto views = std::vector<std::string_view>(docs.begin(), docs.end());
+
+  for (const size_t num_workers : {1, 2, 4}) {
+    auto pool = rfl::ThreadPool(num_workers);
+
+    EXPECT_EQ(pool.num_workers(), num_workers);
+
+    // The pool can be reused for several batches.
+    for (int k = 0; k < 2; ++k) {
+      const auto results = rfl::json::read_many<Person>(views, pool);
+
+      ASSERT_EQ(results.size(), docs.size());
+
+      for (size_t i = 0; i < results.size(); ++i) {
+        if (i % 100 == 99) {
+          EXPECT_FALSE(results[i] && true);
+        } else {
+          EXPECT_EQ(results[i].value().first_name,
+                    "Person" + std::to_string(i));
+          EXPECT_EQ(results[i].value().age, static_cast<int>(i));
+        }
+      }
+    }
+  }
+
+  // Move-only types are supported as well.
+  auto pool = rfl::ThreadPool(2);
+  const auto ptrs = rfl::json::read_many<std::unique_ptr<Person>>(views, pool);
+  ASSERT_EQ(ptrs.size(), docs.size());
+  EXPECT_EQ(ptrs[0].value()->first_name, "Person0");
+  EXPECT_FALSE(ptrs[99] && true);
+}
+}  // namespace test_read_many
@@ -0,0 +1,52 @@
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_rfl_variant_many_alternatives {
+
+struct Circle {
+  double radius;
+};
+
+struct Rectangle {
+  double height;
+  double width;
+};
+
+struct Square {
+  double width;
+};
+
+using Values = rfl::Variant<bool, int, double, std::string, Circle, Rectangle,
+                            Square, std::vector<int>>;
+
+TEST(json, test_rfl_variant_many_alternatives) {
+  const auto values =
+      std::vector<Values>({true, 5, 3.5, std::string("hello"),
+                           Circle{.radius = 2.0}, Square{.width = 3.0},
+                           std::vector<int>({1, 2, 3})});
+
+  write_and_read(
+      values,
+      R"([true,5,3.5,"hello",{"radius":2.0},{"width":3.0},[1,2,3]])");
+
+  auto copy = values;
+  EXPECT_EQ(copy.at(3).index(), 3);
+  EXPECT_EQ(rfl::get<std::string>(copy.at(3)), "hello");
+  EXPECT_EQ(rfl::get<6>(copy.at(5)).width, 3.0);
+
+  auto moved = std::move(copy);
+  EXPECT_EQ(rfl::get<std::vector<int>>(moved.at(6)).size(), 3u);
+
+  // Alternatives of the same type are told apart by their index.
+  auto v = rfl::Variant<int, int, int, int, int, int>();
+  v.emplace<4>(7);
+  EXPECT_EQ(v.index(), 4);
+  const auto w = v;
+  EXPECT_EQ(w.index(), 4);
+  EXPECT_EQ(w.visit([](const int _i) { return _i; }), 7);
+}
+}  // namespace test_rfl_variant_many_alternatives
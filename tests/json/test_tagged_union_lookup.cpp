@@ -0,0 +1,52 @@
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace test_tagged_union_lookup {
+
+struct Circle {
+  double radius;
+};
+
+struct Rectangle {
+  double height;
+  double width;
+};
+
+struct Square {
+  rfl::Literal<"square", "Square"> shape;
+  double width;
+};
+
+using Shapes = rfl::TaggedUnion<"shape", Circle, Square, Rectangle>;
+
+TEST(json, test_tagged_union_lookup) {
+  const auto r1 = rfl::json::read<Shapes>(
+      R"({"shape":"Square","width":5.0})");
+  ASSERT_TRUE(r1 && true) << r1.error().value().what();
+  EXPECT_EQ(rfl::get<Square>(r1.value().variant_).shape.str(), "Square");
+  EXPECT_EQ(rfl::get<Square>(r1.value().variant_).width, 5.0);
+
+  // The discriminator does not have to be the first field.
+  const auto r2 = rfl::json::read<Shapes>(
+      R"({"height":10.0,"width":5.0,"shape":"Rectangle"})");
+  ASSERT_TRUE(r2 && true) << r2.error().value().what();
+  EXPECT_EQ(rfl::get<Rectangle>(r2.value().variant_).height, 10.0);
+
+  const auto r3 = rfl::json::read<Shapes>(
+      R"({"shape":"triangle","width":5.0})");
+  ASSERT_FALSE(r3 && true);
+  EXPECT_EQ(r3.error().value().what(),
+            std::string("Could not parse tagged union, could not match shape "
+                        "'triangle'. The following tags are allowed: Circle, "
+                        "square, Square, Rectangle"));
+
+  const auto r4 = rfl::json::read<Shapes>(R"({"shape":5,"width":5.0})");
+  ASSERT_FALSE(r4 && true);
+  EXPECT_EQ(r4.error().value().what(),
+            std::string("Could not parse tagged union: Could not find field "
+                        "'shape' or type of field was not a string."));
+}
+}  // namespace test_tagged_union_lookup
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_variant_shapes {
+
+struct Circle {
+  double radius;
+};
+
+struct Rectangle {
+  double height;
+  double width;
+};
+
+struct Square {
+  double width;
+  std::optional<std::string> color;
+};
+
+struct Created {
+  rfl::Literal<"created"> event;
+  std::string id;
+};
+
+struct Deleted {
+  rfl::Literal<"deleted", "removed"> event;
+  std::string id;
+};
+
+using Shapes = std::variant<Circle, Rectangle, Square, int>;
+
+using Events = rfl::Variant<Created, Deleted>;
+
+TEST(json, test_variant_shapes) {
+  write_and_read(Shapes(Rectangle{.height = 10, .width = 5}),
+                 R"({"height":10.0,"width":5.0})");
+
+  write_and_read(Shapes(Square{.width = 5, .color = "red"}),
+                 R"({"width":5.0,"color":"red"})");
+
+  write_and_read(Shapes(3), "3");
+
+  write_and_read(Events(Deleted{.event = std::string("removed"), .id = "abc"}),
+                 R"({"event":"removed","id":"abc"})");
+
+  const auto res = rfl::json::read<Shapes>(R"({"radius":"large"})");
+  ASSERT_FALSE(res && true);
+
+  // The error message still contains the reasons for all alternatives.
+  const std::string expected =
+      R"(Could not parse the variant. Each of the possible alternatives failed for the following reasons: 
+1) Failed to parse field 'radius': Could not cast to double.
+2) Found 2 errors:
+    1) Field named 'height' not found.
+    2) Field named 'width' not found.
+3) Field named 'width' not found.
+4) Could not cast to int.)";
+  EXPECT_EQ(res.error()->what(), expected);
+}
+
+/// Counts how often it has been parsed.
+struct Counted {
+  int value;
+
+  static inline int num_parsed = 0;
+};
+
+struct First {
+  int first;
+  Counted counted;
+};
+
+struct Second {
+  int second;
+  Counted counted;
+};
+
+struct Temperature {
+  double kelvin;
+};
+
+struct TemperatureImpl {
+  double celsius;
+
+  static TemperatureImpl from_class(const Temperature& _t) noexcept {
+    return TemperatureImpl{.celsius = _t.kelvin - 273.0};
+  }
+
+  Temperature to_class() const {
+    return Temperature{.kelvin = celsius + 273.0};
+  }
+};
+
+}  // namespace test_variant_shapes
+
+namespace rfl {
+template <>
+struct Reflector<test_variant_shapes::Counted> {
+  using ReflType = int;
+
+  static test_variant_shapes::Counted to(const ReflType& _v) noexcept {
+    ++test_variant_shapes::Counted::num_parsed;
+    return test_variant_shapes::Counted{_v};
+  }
+};
+
+namespace parsing {
+
+template <class ReaderType, class WriterType, class ProcessorsType>
+struct Parser<ReaderType, WriterType, test_variant_shapes::Temperature,
+              ProcessorsType>
+    : public CustomParser<ReaderType, WriterType, ProcessorsType,
+                          test_variant_shapes::Temperature,
+                          test_variant_shapes::TemperatureImpl> {};
+
+}  // namespace parsing
+}  // namespace rfl
+
+namespace test_variant_shapes {
+
+TEST(json, test_variant_shapes_skips_alternatives) {
+  // First is ruled out, because "first" is missing, so "counted" must only
+  // be parsed once, by Second.
+  Counted::num_parsed = 0;
+  const auto res = rfl::json::read<std::variant<First, Second>>(
+      R"({"second":2,"counted":1})");
+  ASSERT_TRUE(res && true) << res.error()->what();
+  EXPECT_EQ(res.value().index(), 1u);
+  EXPECT_EQ(Counted::num_parsed, 1);
+}
+
+TEST(json, test_variant_shapes_custom_parser) {
+  // Temperature is an aggregate, but its Parser expects "celsius", not
+  // "kelvin", so it must not be ruled out.
+  const auto res = rfl::json::read<std::variant<Circle, Temperature>>(
+      R"({"celsius":20.0})");
+  ASSERT_TRUE(res && true) << res.error()->what();
+  ASSERT_EQ(res.value().index(), 1u);
+  EXPECT_EQ(std::get<1>(res.value()).kelvin, 293.0);
+}
+
+}  // namespace test_variant_shapes
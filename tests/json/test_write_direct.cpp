@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_write_direct {
+
+struct Person {
+  rfl::Rename<"firstName", std::string> first_name;
+  std::string last_name = "Simpson";
+  std::optional<std::string> town;
+  std::vector<Person> children;
+};
+
+struct Values {
+  bool b;
+  int8_t i8;
+  int64_t i64;
+  uint64_t u64;
+  float f;
+  std::vector<double> doubles;
+  std::string escaped;
+  std::map<std::string, std::vector<int>> map;
+  std::vector<std::vector<int>> nested;
+  std::variant<int, std::string> variant;
+  std::optional<int> nothing;
+  rfl::Rename<"escaped \"key\"\t\x01", int> escaped_key;
+};
+
+TEST(json, test_write_direct) {
+  const auto bart = Person{.first_name = "Bart", .town = "Springfield"};
+
+  const auto homer =
+      Person{.first_name = "Homer",
+             .children = std::vector<Person>({bart, Person{"Lisa"}, {}})};
+
+  EXPECT_EQ(rfl::json::write_direct(homer), rfl::json::write(homer));
+  EXPECT_EQ(rfl::json::write_direct(homer, rfl::json::pretty),
+            rfl::json::write(homer, rfl::json::pretty));
+
+  const auto values = Values{
+      .b = true,
+      .i8 = -12,
+      .i64 = -9223372036854775807,
+      .u64 = 18446744073709551615u,
+      .f = 0.1f,
+      .doubles = {0.0, -0.0, 1.0, 0.1, -2.5, 1e20, 1e21, 1e-6, 1e-7, 5e-324,
+                  1.7976931348623157e308, 123456789012345678.0, 3.14159},
+      .escaped = "quote\" backslash\\ slash/ \b\f\n\r\t \x01\x1f \xc3\xa9",
+      .map = {{"a", {}}, {"b", {1, 2, 3}}},
+      .nested = {{}, {1}, {2, 3}},
+      .variant = "string",
+      .escaped_key = 42};
+
+  EXPECT_EQ(rfl::json::write_direct(values), rfl::json::write(values));
+  EXPECT_EQ(rfl::json::write_direct(values, rfl::json::pretty),
+            rfl::json::write(values, rfl::json::pretty));
+
+  EXPECT_EQ(rfl::json::write_direct(std::vector<int>()), "[]");
+  EXPECT_EQ(rfl::json::write_direct(std::string("root")), "\"root\"");
+  EXPECT_EQ(rfl::json::write_direct(std::optional<int>()), "null");
+
+  auto stream = std::stringstream();
+  rfl::json::write_direct(homer, stream, rfl::json::pretty);
+  EXPECT_EQ(stream.str(), rfl::json::write(homer, rfl::json::pretty));
+
+  // Large enough for the buffer to be flushed into the stream several times.
+  const auto many = std::vector<Person>(5000, homer);
+  auto stream2 = std::stringstream();
+  rfl::json::write_direct(many, stream2);
+  EXPECT_EQ(stream2.str(), rfl::json::write(many));
+}
+}  // namespace test_write_direct
@@ -0,0 +1,35 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_borrowed {
+
+struct TestStruct {
+  std::string_view name;
+  rfl::BytestringView bytestring;
+};
+
+TEST(msgpack, test_read_borrowed) {
+  const auto bytestring = rfl::Bytestring(
+      {std::byte{13}, std::byte{14}, std::byte{15}, std::byte{16}});
+
+  const auto test = TestStruct{.name = "Homer", .bytestring = bytestring};
+
+  const auto serialized = rfl::msgpack::write(test);
+
+  const auto res = rfl::msgpack::read_borrowed<TestStruct>(serialized);
+
+  const auto& borrowed = res.value();
+
+  EXPECT_EQ(borrowed->name, "Homer");
+  EXPECT_EQ(rfl::Bytestring(borrowed->bytestring.data(),
+                            borrowed->bytestring.size()),
+            bytestring);
+  EXPECT_EQ(rfl::msgpack::write(*borrowed), serialized);
+}
+}  // namespace test_read_borrowed
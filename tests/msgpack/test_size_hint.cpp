@@ -0,0 +1,59 @@
+#include <map>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_size_hint {
+
+struct Containers {
+  std::vector<int> numbers;
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, int> map;
+  std::map<std::string, int> ordered;
+  std::unordered_set<std::string> set;
+};
+
+TEST(msgpack, test_size_hint) {
+  constexpr int size = 10000;
+
+  auto containers = Containers{};
+  for (int i = 0; i < size; ++i) {
+    const auto str = std::to_string(i);
+    containers.numbers.push_back(i);
+    containers.strings.push_back(str);
+    containers.map[str] = i;
+    containers.ordered[str] = i;
+    containers.set.insert(str);
+  }
+
+  const auto res =
+      rfl::msgpack::read<Containers>(rfl::msgpack::write(containers));
+  ASSERT_TRUE(res && true) << res.error()->what();
+
+  // The vectors have been reserved from the size hint, so they have not
+  // grown beyond the number of elements.
+  EXPECT_EQ(res.value().numbers, containers.numbers);
+  EXPECT_EQ(res.value().numbers.capacity(), containers.numbers.size());
+  EXPECT_EQ(res.value().strings, containers.strings);
+  EXPECT_EQ(res.value().strings.capacity(), containers.strings.size());
+  EXPECT_EQ(res.value().map, containers.map);
+  EXPECT_EQ(res.value().ordered, containers.ordered);
+  EXPECT_EQ(res.value().set, containers.set);
+
+  // A size hint of zero cannot be told apart from an unknown size, so empty
+  // containers must take the regular path.
+  const auto empty = Containers{};
+  write_and_read(empty);
+  const auto res_empty =
+      rfl::msgpack::read<Containers>(rfl::msgpack::write(empty));
+  ASSERT_TRUE(res_empty && true) << res_empty.error()->what();
+  EXPECT_TRUE(res_empty.value().numbers.empty());
+  EXPECT_TRUE(res_empty.value().map.empty());
+}
+
+}  // namespace test_size_hint
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+namespace test_stream_reader {
+
+struct Person {
+  std::string first_name;
+  std::string last_name = "Simpson";
+  int age;
+};
+
+struct Other {
+  std::vector<int> numbers;
+};
+
+TEST(msgpack, test_stream_reader) {
+  const auto people = std::vector<Person>{
+      Person{.first_name = "Homer", .age = 45},
+      Person{.first_name = "Marge", .age = 42},
+      Person{.first_name = "Bart", .age = 10}};
+
+  std::vector<char> stream;
+  for (const auto& p : people) {
+    const auto bytes = rfl::msgpack::write(p);
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const auto other = rfl::msgpack::write(Other{.numbers = {1, 2, 3}});
+  stream.insert(stream.end(), other.begin(), other.end());
+  const auto last = rfl::msgpack::write(people[0]);
+  stream.insert(stream.end(), last.begin(), last.end());
+
+  for (const size_t chunk_size : {1u, 3u, 7u, 1000u}) {
+    auto reader = rfl::msgpack::StreamReader<Person>();
+    std::vector<rfl::Result<Person>> results;
+    for (size_t i = 0; i < stream.size(); i += chunk_size) {
+      const auto size = std::min(chunk_size, stream.size() - i);
+      ASSERT_TRUE(reader.feed(stream.data() + i, size) && true);
+      while (auto res = reader.next()) {
+        results.emplace_back(std::move(*res));
+      }
+    }
+
+    ASSERT_EQ(results.size(), people.size() + 2);
+    for (size_t i = 0; i < people.size(); ++i) {
+      ASSERT_TRUE(results[i] && true) << results[i].error()->what();
+      EXPECT_EQ(results[i].value().first_name, people[i].first_name);
+      EXPECT_EQ(results[i].value().age, people[i].age);
+    }
+    EXPECT_FALSE(results[people.size()] && true);
+    EXPECT_EQ(results.back().value().first_name, "Homer");
+    EXPECT_FALSE(reader.next());
+  }
+}
+
+}  // namespace test_stream_reader
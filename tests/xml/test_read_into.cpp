@@ -0,0 +1,40 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/xml.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_read_into {
+
+struct Person {
+  std::string xml_content;
+  rfl::Attribute<std::string> town = "Springfield";
+  std::vector<Person> child;
+};
+
+TEST(xml, test_read_into) {
+  const auto bart = Person{.xml_content = "Bart Simpson"};
+
+  const auto lisa = Person{.xml_content = "Lisa Simpson"};
+
+  const auto homer = Person{.xml_content = "Homer Simpson",
+                            .child = std::vector<Person>({bart, lisa})};
+
+  const auto marge = Person{.xml_content = "Marge Simpson",
+                            .town = "Shelbyville",
+                            .child = std::vector<Person>({lisa})};
+
+  auto person = Person{};
+
+  const auto res1 = rfl::xml::read_into(person, rfl::xml::write(homer));
+  ASSERT_TRUE(res1 && true) << res1.error()->what();
+  EXPECT_EQ(rfl::xml::write(person), rfl::xml::write(homer));
+
+  const auto res2 = rfl::xml::read_into(person, rfl::xml::write(marge));
+  ASSERT_TRUE(res2 && true) << res2.error()->what();
+  EXPECT_EQ(rfl::xml::write(person), rfl::xml::write(marge));
+}
+
+}  // namespace test_read_into
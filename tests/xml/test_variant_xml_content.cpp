@@ -0,0 +1,33 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <string>
+#include <variant>
+
+#include "write_and_read.hpp"
+
+namespace test_variant_xml_content {
+
+struct Circle {
+  double radius;
+};
+
+struct Label {
+  std::string xml_content;
+  rfl::Attribute<std::string> color;
+};
+
+using Shapes = std::variant<Circle, Label>;
+
+TEST(xml, test_variant_xml_content) {
+  // The text content is not among the children or attributes, but Label
+  // must not be ruled out for lacking it.
+  const Shapes l = Label{.xml_content = "Hello", .color = "red"};
+
+  write_and_read<"root">(l);
+
+  const auto res = rfl::xml::read<Shapes>(rfl::xml::write<"root">(l));
+  ASSERT_TRUE(res && true) << res.error()->what();
+  ASSERT_EQ(res.value().index(), 1u);
+  EXPECT_EQ(std::get<1>(res.value()).xml_content, "Hello");
+}
+}  // namespace test_variant_xml_content